@@ -0,0 +1,505 @@
+/*
+ * Outdoor scaling benchmark:
+ * - Compiles the module source against the mock core and drives its hot paths
+ *   (override parsing, config load, ComputeScaling, spawn, spell hit with and
+ *   without the cached record, melee hit, DoT tick and heal hooks, creature
+ *   update after a profile switch, .os dump snapshot).
+ * - Reports ns/op plus heap allocations and bytes per op.
+ *
+ * Usage: outdoor_scaling_bench [scale]
+ *   scale multiplies every op count (default 1.0, e.g. 0.1 for a quick run).
+ */
+
+// The module keeps its logic in an anonymous namespace; compiling it into
+// this translation unit benchmarks exactly the code the worldserver runs.
+#include "mod_outdoor_scaling.cpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+#include <random>
+#include <thread>
+
+namespace
+{
+    std::atomic<uint64> gAllocations{ 0 };
+    std::atomic<uint64> gAllocatedBytes{ 0 };
+}
+
+void* operator new(std::size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    gAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    constexpr uint32 TemplateCount = 20000;
+    constexpr uint32 CreatureOverrideCount = 5000;
+    constexpr uint32 ZoneOverrideCount = 200;
+    constexpr uint32 AreaOverrideCount = 400;
+    constexpr uint32 RegionOverrideCount = 300;
+    constexpr uint32 ZonesPerMap = 300;
+    // Grid loads: each grid holds a few camps of the same handful of entries.
+    constexpr uint32 GridCount = 32;
+    constexpr uint32 CreaturesPerGrid = 300;
+    constexpr uint32 EntriesPerGrid = 12;
+    // Continent coordinates span roughly +-WorldExtent yards on both axes.
+    constexpr float WorldExtent = 9000.0f;
+
+    volatile int64 gSink = 0;
+
+    uint64 Scaled(uint64 ops, double scale)
+    {
+        uint64 scaled = uint64(double(ops) * scale);
+        return scaled ? scaled : 1;
+    }
+
+    template<class Body>
+    void Run(char const* name, uint64 ops, Body&& body)
+    {
+        uint64 allocations = gAllocations.load(std::memory_order_relaxed);
+        uint64 bytes = gAllocatedBytes.load(std::memory_order_relaxed);
+        auto const start = std::chrono::steady_clock::now();
+
+        body();
+
+        auto const end = std::chrono::steady_clock::now();
+        double ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        double allocationsPerOp = double(gAllocations.load(std::memory_order_relaxed) - allocations) / double(ops);
+        double bytesPerOp = double(gAllocatedBytes.load(std::memory_order_relaxed) - bytes) / double(ops);
+
+        std::printf("%-42s %12llu ops %12.1f ns/op %10.3f allocs/op %12.1f B/op\n",
+            name, static_cast<unsigned long long>(ops), ns / double(ops), allocationsPerOp, bytesPerOp);
+    }
+
+    // A realistic spread of outdoor (and some instanced) creatures.
+    struct BenchWorld
+    {
+        std::vector<MapEntry> mapEntries;
+        std::vector<std::unique_ptr<Map>> maps;
+        std::vector<CreatureTemplate> templates;
+        std::vector<std::unique_ptr<Creature>> creatures;
+        // Kalimdor, loaded grid by grid.
+        std::vector<std::vector<std::unique_ptr<Creature>>> grids;
+        std::vector<uint32> zonePool;
+        std::string creatureOverrides;
+        std::string zoneOverrides;
+        std::string areaOverrides;
+        std::string regionOverrides;
+    };
+
+    float RandomCoord(std::mt19937& rng)
+    {
+        return std::uniform_real_distribution<float>(-WorldExtent, WorldExtent)(rng);
+    }
+
+    uint32 PickRank(std::mt19937& rng)
+    {
+        uint32 roll = rng() % 100;
+        if (roll < 80)
+            return CREATURE_ELITE_NORMAL;
+        if (roll < 94)
+            return CREATURE_ELITE_ELITE;
+        if (roll < 97)
+            return CREATURE_ELITE_RARE;
+        if (roll < 99)
+            return CREATURE_ELITE_RAREELITE;
+        return CREATURE_ELITE_WORLDBOSS;
+    }
+
+    void BuildWorld(BenchWorld& world, std::mt19937& rng, uint64 creatureCount)
+    {
+        // Eastern Kingdoms, Outland, Northrend, one dungeon and Kalimdor for
+        // grid loads. Maps point into mapEntries, so it is sized once.
+        world.mapEntries.resize(5);
+        world.mapEntries[0] = { 0, 0, true };
+        world.mapEntries[1] = { 530, 1, true };
+        world.mapEntries[2] = { 571, 2, true };
+        world.mapEntries[3] = { 36, 0, false };
+        world.mapEntries[4] = { 1, 0, true };
+        for (MapEntry const& entry : world.mapEntries)
+            sMapStore.SetEntry(entry.MapID, &entry);
+
+        world.maps.push_back(std::make_unique<Map>(0, &world.mapEntries[0], false, "Eastern Kingdoms"));
+        world.maps.push_back(std::make_unique<Map>(530, &world.mapEntries[1], false, "Outland"));
+        world.maps.push_back(std::make_unique<Map>(571, &world.mapEntries[2], false, "Northrend"));
+        world.maps.push_back(std::make_unique<Map>(36, &world.mapEntries[3], true, "Deadmines"));
+        world.maps.push_back(std::make_unique<Map>(1, &world.mapEntries[4], false, "Kalimdor"));
+
+        world.templates.resize(TemplateCount);
+        for (uint32 i = 0; i < TemplateCount; ++i)
+        {
+            world.templates[i].Entry = i + 1;
+            world.templates[i].rank = PickRank(rng);
+            world.templates[i].Name = "Creature";
+        }
+
+        for (uint32 i = 0; i < ZonesPerMap * 3; ++i)
+            world.zonePool.push_back(1 + rng() % 4500);
+
+        for (uint32 i = 0; i < CreatureOverrideCount; ++i)
+        {
+            if (i)
+                world.creatureOverrides += ", ";
+            world.creatureOverrides += std::to_string(1 + rng() % TemplateCount) + " " +
+                std::to_string(0.5f + float(rng() % 300) / 100.0f) + " " +
+                std::to_string(0.5f + float(rng() % 200) / 100.0f);
+        }
+
+        for (uint32 i = 0; i < ZoneOverrideCount; ++i)
+        {
+            if (i)
+                world.zoneOverrides += ", ";
+            world.zoneOverrides += std::to_string(world.zonePool[rng() % world.zonePool.size()]) + " " +
+                std::to_string(0.75f + float(rng() % 100) / 100.0f);
+        }
+
+        // Areas are numbered after the zones; each zone has a few.
+        for (uint32 i = 0; i < AreaOverrideCount; ++i)
+        {
+            if (i)
+                world.areaOverrides += ", ";
+            world.areaOverrides += std::to_string(5000 + rng() % (ZonesPerMap * 3 * 4)) + " " +
+                std::to_string(0.75f + float(rng() % 100) / 100.0f);
+        }
+
+        // Elite camps and world boss arenas: small circles and rectangles.
+        for (uint32 i = 0; i < RegionOverrideCount; ++i)
+        {
+            if (i)
+                world.regionOverrides += ", ";
+
+            float x = RandomCoord(rng);
+            float y = RandomCoord(rng);
+            float size = 30.0f + float(rng() % 170);
+            world.regionOverrides += std::to_string(world.mapEntries[i % 3].MapID) +
+                (i % 2 ? " circle " + std::to_string(x) + " " + std::to_string(y) + " " + std::to_string(size) :
+                    " rect " + std::to_string(x) + " " + std::to_string(y) + " " + std::to_string(x + size) + " " + std::to_string(y + size)) +
+                " " + std::to_string(1.0f + float(rng() % 200) / 100.0f);
+        }
+
+        world.creatures.reserve(creatureCount);
+        for (uint64 i = 0; i < creatureCount; ++i)
+        {
+            // 95% on continents, the rest in the dungeon.
+            uint32 mapIndex = (rng() % 100) < 95 ? rng() % 3 : 3;
+            CreatureTemplate const* cinfo = &world.templates[rng() % TemplateCount];
+
+            auto creature = std::make_unique<Creature>(cinfo, ObjectGuid::LowType(i + 1), ObjectGuid(uint64(0xF130000000000000ull) | (i + 1)));
+            uint32 zoneIndex = mapIndex % 3 * ZonesPerMap + rng() % ZonesPerMap;
+            creature->SetZoneId(world.zonePool[zoneIndex]);
+            creature->SetAreaId(5000 + zoneIndex * 4 + rng() % 4);
+            creature->Relocate(RandomCoord(rng), RandomCoord(rng));
+            creature->SetLevel(uint8(1 + rng() % 80));
+            creature->SetPet((rng() % 100) < 2);
+            world.maps[mapIndex]->AddToMap(creature.get());
+            world.creatures.push_back(std::move(creature));
+        }
+
+        uint64 nextGuid = creatureCount + 1;
+        world.grids.resize(GridCount);
+        for (uint32 grid = 0; grid < GridCount; ++grid)
+        {
+            uint32 zoneId = 9000 + grid / 4;
+            float originX = float(grid % 8) * 533.3333f;
+            float originY = float(grid / 8) * 533.3333f;
+            uint32 firstTemplate = rng() % (TemplateCount - EntriesPerGrid);
+
+            for (uint32 i = 0; i < CreaturesPerGrid; ++i, ++nextGuid)
+            {
+                CreatureTemplate const* cinfo = &world.templates[firstTemplate + rng() % EntriesPerGrid];
+                auto creature = std::make_unique<Creature>(cinfo, ObjectGuid::LowType(nextGuid), ObjectGuid(uint64(0xF130000000000000ull) | nextGuid));
+                creature->SetZoneId(zoneId);
+                creature->SetAreaId(zoneId);
+                creature->Relocate(originX + float(rng() % 533), originY + float(rng() % 533));
+                creature->SetLevel(uint8(10 + grid % 50 + rng() % 3));
+                world.maps[4]->AddToMap(creature.get());
+                world.grids[grid].push_back(std::move(creature));
+            }
+        }
+    }
+
+    void ApplyConfig(BenchWorld const& world)
+    {
+        sConfigMgr->Clear();
+        sConfigMgr->SetOption("OutdoorScaling.Enable", "1");
+        sConfigMgr->SetOption("OutdoorScaling.Reapply.Enable", "1");
+        sConfigMgr->SetOption("OutdoorScaling.Continent.0.Health", "1.5");
+        sConfigMgr->SetOption("OutdoorScaling.Continent.1.Health", "1.25");
+        sConfigMgr->SetOption("OutdoorScaling.Continent.2.Health", "1.1");
+        sConfigMgr->SetOption("OutdoorScaling.Continent.0.Damage", "1.3");
+        sConfigMgr->SetOption("OutdoorScaling.Continent.1.Damage", "1.2");
+        sConfigMgr->SetOption("OutdoorScaling.Continent.2.Damage", "1.05");
+        sConfigMgr->SetOption("OutdoorScaling.Rank.Elite.Health", "1.2");
+        sConfigMgr->SetOption("OutdoorScaling.ZoneOverrides", world.zoneOverrides);
+        sConfigMgr->SetOption("OutdoorScaling.CreatureOverrides", world.creatureOverrides);
+        sConfigMgr->SetOption("OutdoorScaling.AreaOverrides", world.areaOverrides);
+        sConfigMgr->SetOption("OutdoorScaling.RegionOverrides", world.regionOverrides);
+        sConfigMgr->SetOption("OutdoorScaling.Level.0.Curve", "1 1.0, 20 1.3 1.1, 40 1.6 1.25, 60 1.4 1.2");
+        sConfigMgr->SetOption("OutdoorScaling.LevelDelta.0.Curve", "-5 0.8, 0 1.0, 3 1.2, 10 1.5");
+        sConfigMgr->SetOption("OutdoorScaling.Profiles", "Event");
+        sConfigMgr->SetOption("OutdoorScaling.Profile.Event.Schedule", "* 00:00-24:00");
+        sConfigMgr->SetOption("OutdoorScaling.Profile.Event.Continent.0.Health", "2.0");
+        sConfigMgr->SetOption("OutdoorScaling.Profile.Event.ZoneOverrides", world.zoneOverrides);
+
+        // Non-default world rates so normalization is exercised.
+        sWorld->setRate(RATE_CREATURE_ELITE_ELITE_HP, 2.0f);
+        sWorld->setRate(RATE_CREATURE_ELITE_ELITE_DAMAGE, 1.5f);
+        sWorld->setRate(RATE_CREATURE_ELITE_ELITE_SPELLDAMAGE, 1.5f);
+    }
+
+    void SpawnAll(BenchWorld& world, OutdoorScaling_AllCreatureScript& creatureScript)
+    {
+        for (auto const& creature : world.creatures)
+        {
+            creature->ResetBaseStats(4200, 110.0f, 160.0f);
+            creatureScript.OnCreatureSelectLevel(creature->GetCreatureTemplate(), creature.get());
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    double scale = argc > 1 ? std::atof(argv[1]) : 1.0;
+    if (scale <= 0.0)
+        scale = 1.0;
+
+    uint64 const spawnOps = Scaled(100000, scale);
+    uint64 const hitOps = Scaled(10000000, scale);
+    uint64 const resolveOps = Scaled(10000000, scale);
+    uint64 const reloadOps = Scaled(50, scale);
+    uint64 const gridRounds = Scaled(10, scale);
+    uint64 const gridOps = gridRounds * GridCount * CreaturesPerGrid;
+
+    std::mt19937 rng(0x05CA1E);
+    BenchWorld world;
+    BuildWorld(world, rng, spawnOps);
+    ApplyConfig(world);
+
+    OutdoorScaling_WorldScript worldScript;
+    OutdoorScaling_AllCreatureScript creatureScript;
+    OutdoorScaling_AllMapScript mapScript;
+    OutdoorScaling_UnitScript unitScript;
+
+    std::printf("creatures: %llu, templates: %u, creature overrides: %u, zone overrides: %u, area overrides: %u, region overrides: %u\n\n",
+        static_cast<unsigned long long>(world.creatures.size()), TemplateCount, CreatureOverrideCount, ZoneOverrideCount,
+        AreaOverrideCount, RegionOverrideCount);
+
+    Run("ParseOverrideString (5k rows)", reloadOps, [&]()
+    {
+        OverrideRows rows;
+        for (uint64 i = 0; i < reloadOps; ++i)
+        {
+            rows.clear();
+            ParseOverrideString(world.creatureOverrides, "OutdoorScaling.CreatureOverrides", rows);
+            gSink = gSink + int64(rows.size());
+        }
+    });
+
+    Run("Config load", reloadOps, [&]()
+    {
+        for (uint64 i = 0; i < reloadOps; ++i)
+        {
+            worldScript.OnAfterConfigLoad(false);
+            worldScript.OnUpdate(0);
+        }
+    });
+
+    // Precomputed inputs so the loop measures the resolve, not the RNG.
+    std::vector<ScalingQuery> resolveInputs(1 << 16);
+    for (ScalingQuery& input : resolveInputs)
+        input = MakeScalingQuery(world.creatures[rng() % world.creatures.size()].get());
+
+    Run("ComputeScaling", resolveOps, [&]()
+    {
+        OutdoorScalingConfig const& config = gConfigStore.Get();
+        for (uint64 i = 0; i < resolveOps; ++i)
+        {
+            ScalingQuery const& input = resolveInputs[i & (resolveInputs.size() - 1)];
+            gSink = gSink + int64(ComputeScaling(config, input).factors[SCALING_STAT_HEALTH]);
+        }
+    });
+
+    Run("Spawn (first, OnCreatureSelectLevel)", spawnOps, [&]()
+    {
+        SpawnAll(world, creatureScript);
+    });
+
+    Run("Respawn (OnCreatureSelectLevel)", spawnOps, [&]()
+    {
+        SpawnAll(world, creatureScript);
+    });
+
+    // One grid per map update: a few camps of the same handful of entries.
+    Run("Grid load (OnCreatureSelectLevel)", gridOps, [&]()
+    {
+        for (uint64 round = 0; round < gridRounds; ++round)
+        {
+            for (auto const& grid : world.grids)
+            {
+                for (auto const& creature : grid)
+                {
+                    creature->ResetBaseStats(4200, 110.0f, 160.0f);
+                    creatureScript.OnCreatureSelectLevel(creature->GetCreatureTemplate(), creature.get());
+                }
+
+                mapScript.OnMapUpdate(world.maps[4].get(), 0);
+            }
+        }
+    });
+
+    std::vector<Creature*> attackers(1 << 16);
+    for (Creature*& attacker : attackers)
+        attacker = world.creatures[rng() % world.creatures.size()].get();
+
+    Run("Spell hit (ModifySpellDamageTaken)", hitOps, [&]()
+    {
+        for (uint64 i = 0; i < hitOps; ++i)
+        {
+            int32 damage = 1000;
+            unitScript.ModifySpellDamageTaken(nullptr, attackers[i & (attackers.size() - 1)], damage, nullptr);
+            gSink = gSink + damage;
+        }
+    });
+
+    // What the spell hit costs without the cached record: the same attackers
+    // resolved from scratch on every hit.
+    Run("Spell hit, resolved per hit (uncached)", hitOps, [&]()
+    {
+        OutdoorScalingConfig const& config = gConfigStore.Get();
+        for (uint64 i = 0; i < hitOps; ++i)
+        {
+            int32 damage = 1000;
+            ScalingResult scaling = ComputeScaling(config, attackers[i & (attackers.size() - 1)]);
+            damage = int32(float(damage) * scaling.factors[SCALING_STAT_SPELL_DAMAGE]);
+            gSink = gSink + damage;
+        }
+    });
+
+    Player player;
+    player.SetLevel(40);
+
+    Run("Melee hit (ModifyMeleeDamage)", hitOps, [&]()
+    {
+        for (uint64 i = 0; i < hitOps; ++i)
+        {
+            uint32 damage = 500;
+            unitScript.ModifyMeleeDamage(&player, attackers[i & (attackers.size() - 1)], damage);
+            gSink = gSink + damage;
+        }
+    });
+
+    Run("DoT tick (ModifyPeriodicDamageAurasTick)", hitOps, [&]()
+    {
+        for (uint64 i = 0; i < hitOps; ++i)
+        {
+            uint32 damage = 300;
+            unitScript.ModifyPeriodicDamageAurasTick(nullptr, attackers[i & (attackers.size() - 1)], damage, nullptr);
+            gSink = gSink + damage;
+        }
+    });
+
+    Run("Creature heal (ModifyHealReceived)", hitOps, [&]()
+    {
+        for (uint64 i = 0; i < hitOps; ++i)
+        {
+            uint32 heal = 800;
+            Creature* healer = attackers[i & (attackers.size() - 1)];
+            unitScript.ModifyHealReceived(healer, healer, heal, nullptr);
+            gSink = gSink + heal;
+        }
+    });
+
+    // Every creature's cached result is stale after a reload.
+    worldScript.OnAfterConfigLoad(true);
+
+    Run("First spell hit after reload", spawnOps, [&]()
+    {
+        for (auto const& creature : world.creatures)
+        {
+            int32 damage = 1000;
+            unitScript.ModifySpellDamageTaken(nullptr, creature.get(), damage, nullptr);
+            gSink = gSink + damage;
+        }
+    });
+
+    // Let the maps see the reload and drain its re-application queue.
+    do
+    {
+        for (auto const& map : world.maps)
+            mapScript.OnMapUpdate(map.get(), 0);
+    } while (gReapplyProgress.activeMaps.load(std::memory_order_relaxed));
+
+    // Back from the always-on profile to the base snapshot: every creature
+    // re-resolves on its first hit; its stats follow at its next update.
+    gConfigStore.Activate(0);
+
+    Run("First spell hit after profile switch", spawnOps, [&]()
+    {
+        for (auto const& creature : world.creatures)
+        {
+            int32 damage = 1000;
+            unitScript.ModifySpellDamageTaken(nullptr, creature.get(), damage, nullptr);
+            gSink = gSink + damage;
+        }
+    });
+
+    for (auto const& map : world.maps)
+        mapScript.OnMapUpdate(map.get(), 0);
+
+    Run("First update after profile switch", spawnOps, [&]()
+    {
+        for (auto const& creature : world.creatures)
+            creatureScript.OnAllCreatureUpdate(creature.get(), 100);
+    });
+
+    Run("Creature update (OnAllCreatureUpdate)", spawnOps, [&]()
+    {
+        for (auto const& creature : world.creatures)
+            creatureScript.OnAllCreatureUpdate(creature.get(), 100);
+    });
+
+    // Map-thread side of .os dump: copying every map's creatures. The writer
+    // runs in the background and is only waited for after timing.
+    sConfigMgr->SetOption("OutdoorScaling.Dump.Directory", std::filesystem::temp_directory_path().string());
+    worldScript.OnAfterConfigLoad(false);
+    worldScript.OnUpdate(0);
+
+    uint64 dumpedCreatures = world.creatures.size() + world.grids.size() * world.grids.front().size();
+    gDump.Start((std::filesystem::temp_directory_path() / "outdoor_scaling_bench_dump.csv").string());
+
+    Run("Dump snapshot (OnMapUpdate)", dumpedCreatures, [&]()
+    {
+        for (auto const& map : world.maps)
+            mapScript.OnMapUpdate(map.get(), 0);
+    });
+
+    while (gDump.Running())
+    {
+        worldScript.OnUpdate(0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::filesystem::remove(gDump.Path());
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+#ifndef OUTDOOR_SCALING_MOCK_CHAT_H
+#define OUTDOOR_SCALING_MOCK_CHAT_H
+
+#include "Creature.h"
+#include "Player.h"
+
+#include <fmt/format.h>
+
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Acore::ChatCommands
+{
+    enum class Console : bool
+    {
+        No = false,
+        Yes = true
+    };
+
+    struct ChatCommandBuilder;
+    using ChatCommandTable = std::vector<ChatCommandBuilder>;
+
+    struct ChatCommandBuilder
+    {
+        template<class Handler>
+        ChatCommandBuilder(char const* name, Handler /*handler*/, uint32 /*permission*/, Console /*allowConsole*/) : Name(name) { }
+        ChatCommandBuilder(char const* name, ChatCommandTable const& /*subCommands*/) : Name(name) { }
+
+        char const* Name;
+    };
+}
+
+// Messages are formatted and dropped; commands are not benchmarked.
+class ChatHandler
+{
+public:
+    Player* GetPlayer() const { return nullptr; }
+    Creature* getSelectedCreature() const { return nullptr; }
+
+    template<class... Args>
+    void PSendSysMessage(fmt::format_string<Args...> fmt, Args&&... args) { (void)fmt::format(fmt, std::forward<Args>(args)...); }
+    void SendSysMessage(std::string_view /*str*/) { }
+    void SendSysMessage(uint32 /*entry*/) { }
+    void SetSentErrorMessage(bool /*val*/) { }
+};
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef OUTDOOR_SCALING_MOCK_COMMON_H
+#define OUTDOOR_SCALING_MOCK_COMMON_H
+
+#include "Define.h"
+
+enum TimeConstants
+{
+    MINUTE          = 60,
+    HOUR            = MINUTE * 60,
+    DAY             = HOUR * 24,
+    IN_MILLISECONDS = 1000
+};
+
+#endif
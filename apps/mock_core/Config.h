@@ -0,0 +1,43 @@
+#ifndef OUTDOOR_SCALING_MOCK_CONFIG_H
+#define OUTDOOR_SCALING_MOCK_CONFIG_H
+
+#include "Define.h"
+
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+class ConfigMgr
+{
+public:
+    static ConfigMgr* instance();
+
+    void SetOption(std::string const& name, std::string const& value) { _options[name] = value; }
+    void Clear() { _options.clear(); }
+
+    template<class T>
+    T GetOption(std::string const& name, T const& def, bool /*showLogs*/ = true) const
+    {
+        auto itr = _options.find(name);
+        if (itr == _options.end())
+            return def;
+
+        if constexpr (std::is_same_v<T, std::string>)
+            return itr->second;
+        else if constexpr (std::is_same_v<T, bool>)
+            return itr->second == "1" || itr->second == "true";
+        else
+        {
+            T value = def;
+            std::istringstream(itr->second) >> value;
+            return value;
+        }
+    }
+
+private:
+    std::unordered_map<std::string, std::string> _options;
+};
+
+#define sConfigMgr ConfigMgr::instance()
+
+#endif
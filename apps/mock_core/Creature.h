@@ -0,0 +1,51 @@
+#ifndef OUTDOOR_SCALING_MOCK_CREATURE_H
+#define OUTDOOR_SCALING_MOCK_CREATURE_H
+
+#include "Unit.h"
+
+struct CreatureTemplate
+{
+    uint32 Entry = 0;
+    uint32 rank = CREATURE_ELITE_NORMAL;
+    uint32 expansion = 0;
+    uint8 minlevel = 1;
+    uint8 maxlevel = 1;
+    std::string Name;
+};
+
+class Creature : public Unit
+{
+public:
+    Creature(CreatureTemplate const* cinfo, ObjectGuid::LowType spawnId, ObjectGuid guid)
+        : _cinfo(cinfo), _spawnId(spawnId)
+    {
+        _isCreature = true;
+        _entry = cinfo->Entry;
+        _guid = guid;
+        _name = cinfo->Name;
+    }
+
+    CreatureTemplate const* GetCreatureTemplate() const { return _cinfo; }
+    ObjectGuid::LowType GetSpawnId() const { return _spawnId; }
+
+    void SetPet(bool isPet) { _isPet = isPet; }
+
+    // What Creature::SelectLevel leaves behind before the script hook runs.
+    void ResetBaseStats(uint32 health, float minDamage, float maxDamage)
+    {
+        _createHealth = health;
+        _maxHealth = health;
+        _health = health;
+        _healthFlatModifier = float(health);
+        for (auto& range : _weaponDamage)
+            range = { minDamage, maxDamage };
+    }
+
+private:
+    CreatureTemplate const* _cinfo;
+    ObjectGuid::LowType _spawnId;
+};
+
+inline Creature* Unit::ToCreature() { return _isCreature ? static_cast<Creature*>(this) : nullptr; }
+
+#endif
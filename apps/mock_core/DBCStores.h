@@ -0,0 +1,27 @@
+#ifndef OUTDOOR_SCALING_MOCK_DBCSTORES_H
+#define OUTDOOR_SCALING_MOCK_DBCSTORES_H
+
+#include "DBCStructure.h"
+
+#include <unordered_map>
+
+// Lookup by id only; tools register the entries they create.
+template<class T>
+class DBCStorage
+{
+public:
+    T const* LookupEntry(uint32 id) const
+    {
+        auto itr = _entries.find(id);
+        return itr != _entries.end() ? itr->second : nullptr;
+    }
+
+    void SetEntry(uint32 id, T const* entry) { _entries[id] = entry; }
+
+private:
+    std::unordered_map<uint32, T const*> _entries;
+};
+
+extern DBCStorage<MapEntry> sMapStore;
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef OUTDOOR_SCALING_MOCK_DBCSTRUCTURE_H
+#define OUTDOOR_SCALING_MOCK_DBCSTRUCTURE_H
+
+#include "Define.h"
+
+struct MapEntry
+{
+    uint32 MapID = 0;
+    uint32 addon = 0;
+    bool continent = false;
+
+    uint32 Expansion() const { return addon; }
+    bool IsContinent() const { return continent; }
+};
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef OUTDOOR_SCALING_MOCK_DATAMAP_H
+#define OUTDOOR_SCALING_MOCK_DATAMAP_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+// Same storage as the core's DataMap, so lookup and allocation costs match.
+class DataMap
+{
+public:
+    class Base
+    {
+    public:
+        virtual ~Base() = default;
+    };
+
+    template<class T>
+    T* Get(std::string const& k) const
+    {
+        auto itr = Container.find(k);
+        if (itr != Container.end())
+            return dynamic_cast<T*>(itr->second.get());
+        return nullptr;
+    }
+
+    template<class T>
+    T* GetDefault(std::string const& k)
+    {
+        if (T* v = Get<T>(k))
+            return v;
+        T* v = new T();
+        Container.emplace(k, std::unique_ptr<T>(v));
+        return v;
+    }
+
+    void Set(std::string const& k, Base* v) { Container[k] = std::unique_ptr<Base>(v); }
+
+    void Erase(std::string const& k) { Container.erase(k); }
+
+private:
+    std::unordered_map<std::string, std::unique_ptr<Base>> Container;
+};
+
+#endif
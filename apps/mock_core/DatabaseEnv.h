@@ -0,0 +1,125 @@
+#ifndef OUTDOOR_SCALING_MOCK_DATABASEENV_H
+#define OUTDOOR_SCALING_MOCK_DATABASEENV_H
+
+#include "Define.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class Field
+{
+public:
+    explicit Field(std::string value = "") : _value(std::move(value)) { }
+    // A NULL column, e.g. from the unmatched side of a LEFT JOIN.
+    explicit Field(std::nullptr_t) : _null(true) { }
+
+    bool IsNull() const { return _null; }
+
+    template<class T>
+    T Get() const
+    {
+        if constexpr (std::is_same_v<T, std::string>)
+            return _value;
+        else
+        {
+            // Read wide so uint8 columns are not taken as characters.
+            std::conditional_t<std::is_floating_point_v<T>, double, int64> value = 0;
+            std::istringstream(_value) >> value;
+            return T(value);
+        }
+    }
+
+private:
+    std::string _value;
+    bool _null = false;
+};
+
+class ResultSet
+{
+public:
+    explicit ResultSet(std::vector<std::vector<Field>> rows) : _rows(std::move(rows)) { }
+
+    Field* Fetch() { return _rows[_row].data(); }
+    bool NextRow() { return ++_row < _rows.size(); }
+    uint64 GetRowCount() const { return _rows.size(); }
+
+private:
+    std::vector<std::vector<Field>> _rows;
+    std::size_t _row = 0;
+};
+
+using QueryResult = std::shared_ptr<ResultSet>;
+
+// Mock queries complete immediately; the callback runs on the next
+// ProcessReadyCallbacks(), like a real query that has finished.
+class QueryCallback
+{
+public:
+    explicit QueryCallback(QueryResult result) : _result(std::move(result)) { }
+
+    QueryCallback&& WithCallback(std::function<void(QueryResult)>&& callback)
+    {
+        _callback = std::move(callback);
+        return std::move(*this);
+    }
+
+    bool InvokeIfReady()
+    {
+        if (_callback)
+            _callback(std::move(_result));
+        return true;
+    }
+
+private:
+    QueryResult _result;
+    std::function<void(QueryResult)> _callback;
+};
+
+template<class T>
+class AsyncCallbackProcessor
+{
+public:
+    T& AddCallback(T&& query)
+    {
+        _callbacks.emplace_back(std::move(query));
+        return _callbacks.back();
+    }
+
+    void ProcessReadyCallbacks()
+    {
+        std::vector<T> updateCallbacks = std::move(_callbacks);
+        _callbacks.clear();
+        for (T& callback : updateCallbacks)
+            callback.InvokeIfReady();
+    }
+
+private:
+    std::vector<T> _callbacks;
+};
+
+using QueryCallbackProcessor = AsyncCallbackProcessor<QueryCallback>;
+
+class WorldDatabaseWorkerPool
+{
+public:
+    // Rows every query returns; empty means no result, as for an empty table.
+    void SetRows(std::vector<std::vector<Field>> rows) { _rows = std::move(rows); }
+
+    QueryCallback AsyncQuery(std::string_view /*sql*/)
+    {
+        return QueryCallback(_rows.empty() ? nullptr : std::make_shared<ResultSet>(_rows));
+    }
+
+private:
+    std::vector<std::vector<Field>> _rows;
+};
+
+extern WorldDatabaseWorkerPool WorldDatabase;
+
+#endif
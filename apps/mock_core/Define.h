@@ -0,0 +1,30 @@
+/*
+ * Mock core: minimal stand-ins for the AzerothCore headers the module
+ * includes, so its source can be compiled and driven outside a worldserver.
+ * Only what the module actually touches is modeled.
+ */
+
+#ifndef OUTDOOR_SCALING_MOCK_DEFINE_H
+#define OUTDOOR_SCALING_MOCK_DEFINE_H
+
+#include <cstdint>
+
+using int8 = std::int8_t;
+using int16 = std::int16_t;
+using int32 = std::int32_t;
+using int64 = std::int64_t;
+using uint8 = std::uint8_t;
+using uint16 = std::uint16_t;
+using uint32 = std::uint32_t;
+using uint64 = std::uint64_t;
+
+enum AccountTypes
+{
+    SEC_PLAYER        = 0,
+    SEC_MODERATOR     = 1,
+    SEC_GAMEMASTER    = 2,
+    SEC_ADMINISTRATOR = 3,
+    SEC_CONSOLE       = 4
+};
+
+#endif
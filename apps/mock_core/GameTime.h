@@ -0,0 +1,17 @@
+#ifndef OUTDOOR_SCALING_MOCK_GAMETIME_H
+#define OUTDOOR_SCALING_MOCK_GAMETIME_H
+
+#include <chrono>
+#include <ctime>
+
+using Seconds = std::chrono::seconds;
+
+namespace GameTime
+{
+    inline Seconds GetGameTime()
+    {
+        return Seconds(std::time(nullptr));
+    }
+}
+
+#endif
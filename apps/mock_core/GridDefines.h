@@ -0,0 +1,15 @@
+#ifndef OUTDOOR_SCALING_MOCK_GRIDDEFINES_H
+#define OUTDOOR_SCALING_MOCK_GRIDDEFINES_H
+
+#include "ObjectGuid.h"
+#include "TypeContainer.h"
+
+class Creature;
+
+#define MAX_NUMBER_OF_GRIDS      64
+#define SIZE_OF_GRIDS            533.3333f
+#define CENTER_GRID_ID           (MAX_NUMBER_OF_GRIDS/2)
+
+typedef TypeUnorderedMapContainer<Creature, ObjectGuid> MapStoredObjectTypesContainer;
+
+#endif
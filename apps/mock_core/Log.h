@@ -0,0 +1,17 @@
+#ifndef OUTDOOR_SCALING_MOCK_LOG_H
+#define OUTDOOR_SCALING_MOCK_LOG_H
+
+#include "Define.h"
+
+#include <fmt/format.h>
+
+// Messages are formatted and dropped, so every format string is checked
+// against its arguments at compile time as it is in the core.
+#define LOG_MESSAGE_BODY(...) do { (void)fmt::format(__VA_ARGS__); } while (0)
+
+#define LOG_ERROR(filterType, ...) LOG_MESSAGE_BODY(__VA_ARGS__)
+#define LOG_WARN(filterType, ...)  LOG_MESSAGE_BODY(__VA_ARGS__)
+#define LOG_INFO(filterType, ...)  LOG_MESSAGE_BODY(__VA_ARGS__)
+#define LOG_DEBUG(filterType, ...) LOG_MESSAGE_BODY(__VA_ARGS__)
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef OUTDOOR_SCALING_MOCK_MAP_H
+#define OUTDOOR_SCALING_MOCK_MAP_H
+
+#include "DBCStructure.h"
+#include "DataMap.h"
+#include "GridDefines.h"
+#include "ObjectGuid.h"
+
+#include <string>
+#include <unordered_map>
+
+class Creature;
+
+class Map
+{
+public:
+    using CreatureBySpawnIdContainer = std::unordered_multimap<ObjectGuid::LowType, Creature*>;
+
+    Map(uint32 id, MapEntry const* entry, bool instanceable, std::string name = "Mock map");
+    ~Map();
+
+    Map(Map const&) = delete;
+    Map& operator=(Map const&) = delete;
+
+    MapEntry const* GetEntry() const { return _entry; }
+    uint32 GetId() const { return _id; }
+    uint32 GetInstanceId() const { return 0; }
+    bool Instanceable() const { return _instanceable; }
+    char const* GetMapName() const { return _name.c_str(); }
+
+    void AddToMap(Creature* creature);
+    void RemoveFromMap(Creature* creature);
+
+    Creature* GetCreature(ObjectGuid const& guid);
+    CreatureBySpawnIdContainer& GetCreatureBySpawnIdStore() { return _creatureBySpawnIdStore; }
+    MapStoredObjectTypesContainer& GetObjectsStore() { return _objectsStore; }
+
+    DataMap CustomData;
+
+private:
+    uint32 _id;
+    MapEntry const* _entry;
+    bool _instanceable;
+    std::string _name;
+    CreatureBySpawnIdContainer _creatureBySpawnIdStore;
+    MapStoredObjectTypesContainer _objectsStore;
+};
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef OUTDOOR_SCALING_MOCK_MAPMGR_H
+#define OUTDOOR_SCALING_MOCK_MAPMGR_H
+
+#include "Map.h"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+// Knows every Map alive; maps register themselves on construction.
+class MapMgr
+{
+public:
+    static MapMgr* instance();
+
+    void DoForAllMaps(std::function<void(Map*)> const& worker)
+    {
+        for (Map* map : _maps)
+            worker(map);
+    }
+
+    void Register(Map* map) { _maps.push_back(map); }
+    void Unregister(Map* map) { std::erase(_maps, map); }
+
+private:
+    std::vector<Map*> _maps;
+};
+
+#define sMapMgr MapMgr::instance()
+
+#endif
@@ -0,0 +1,72 @@
+#include "Config.h"
+#include "Creature.h"
+#include "DBCStores.h"
+#include "DatabaseEnv.h"
+#include "Map.h"
+#include "MapMgr.h"
+#include "World.h"
+
+ConfigMgr* ConfigMgr::instance()
+{
+    static ConfigMgr instance;
+    return &instance;
+}
+
+World* World::instance()
+{
+    static World instance;
+    return &instance;
+}
+
+MapMgr* MapMgr::instance()
+{
+    static MapMgr instance;
+    return &instance;
+}
+
+Map::Map(uint32 id, MapEntry const* entry, bool instanceable, std::string name)
+    : _id(id), _entry(entry), _instanceable(instanceable), _name(std::move(name))
+{
+    sMapMgr->Register(this);
+}
+
+Map::~Map()
+{
+    sMapMgr->Unregister(this);
+}
+
+void Map::AddToMap(Creature* creature)
+{
+    creature->SetMap(this);
+    // Summons have no spawn and are only kept by GUID.
+    if (creature->GetSpawnId())
+        _creatureBySpawnIdStore.emplace(creature->GetSpawnId(), creature);
+    _objectsStore.GetElements()._element[creature->GetGUID()] = creature;
+}
+
+void Map::RemoveFromMap(Creature* creature)
+{
+    auto range = _creatureBySpawnIdStore.equal_range(creature->GetSpawnId());
+    for (auto itr = range.first; itr != range.second; ++itr)
+    {
+        if (itr->second == creature)
+        {
+            _creatureBySpawnIdStore.erase(itr);
+            break;
+        }
+    }
+
+    _objectsStore.GetElements()._element.erase(creature->GetGUID());
+    creature->SetMap(nullptr);
+}
+
+Creature* Map::GetCreature(ObjectGuid const& guid)
+{
+    auto const& creatures = _objectsStore.GetElements()._element;
+    auto itr = creatures.find(guid);
+    return itr != creatures.end() ? itr->second : nullptr;
+}
+
+DBCStorage<MapEntry> sMapStore;
+
+WorldDatabaseWorkerPool WorldDatabase;
@@ -0,0 +1,44 @@
+#ifndef OUTDOOR_SCALING_MOCK_OBJECTGUID_H
+#define OUTDOOR_SCALING_MOCK_OBJECTGUID_H
+
+#include "Define.h"
+
+#include <functional>
+
+enum class HighGuid : uint16
+{
+    Unit    = 0xF130,
+    Pet     = 0xF140,
+    Vehicle = 0xF150
+};
+
+class ObjectGuid
+{
+public:
+    using LowType = uint32;
+
+    ObjectGuid() = default;
+    explicit ObjectGuid(uint64 raw) : _guid(raw) { }
+
+    uint64 GetRawValue() const { return _guid; }
+    LowType GetCounter() const { return LowType(_guid & 0xFFFFFFFF); }
+    HighGuid GetHigh() const { return HighGuid((_guid >> 48) & 0xFFFF); }
+    bool IsPet() const { return GetHigh() == HighGuid::Pet; }
+    bool IsVehicle() const { return GetHigh() == HighGuid::Vehicle; }
+    bool IsEmpty() const { return _guid == 0; }
+
+    bool operator==(ObjectGuid const& other) const { return _guid == other._guid; }
+    bool operator!=(ObjectGuid const& other) const { return _guid != other._guid; }
+    bool operator<(ObjectGuid const& other) const { return _guid < other._guid; }
+
+private:
+    uint64 _guid = 0;
+};
+
+template<>
+struct std::hash<ObjectGuid>
+{
+    std::size_t operator()(ObjectGuid const& guid) const noexcept { return std::hash<uint64>()(guid.GetRawValue()); }
+};
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef OUTDOOR_SCALING_MOCK_PLAYER_H
+#define OUTDOOR_SCALING_MOCK_PLAYER_H
+
+#include "Unit.h"
+
+class Player : public Unit
+{
+};
+
+inline Player* Unit::ToPlayer() { return _isCreature ? nullptr : static_cast<Player*>(this); }
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef OUTDOOR_SCALING_MOCK_SCRIPTMGR_H
+#define OUTDOOR_SCALING_MOCK_SCRIPTMGR_H
+
+#include "Chat.h"
+
+class Creature;
+class Map;
+class Player;
+class SpellInfo;
+class Unit;
+struct CreatureTemplate;
+
+// Script bases only carry the hooks the module overrides; nothing registers.
+
+class WorldScript
+{
+public:
+    explicit WorldScript(char const* /*name*/) { }
+    virtual ~WorldScript() = default;
+
+    virtual void OnBeforeConfigLoad(bool /*reload*/) { }
+    virtual void OnAfterConfigLoad(bool /*reload*/) { }
+    virtual void OnUpdate(uint32 /*diff*/) { }
+};
+
+class AllCreatureScript
+{
+public:
+    explicit AllCreatureScript(char const* /*name*/) { }
+    virtual ~AllCreatureScript() = default;
+
+    virtual void OnAllCreatureUpdate(Creature* /*creature*/, uint32 /*diff*/) { }
+    virtual void OnCreatureSelectLevel(const CreatureTemplate* /*cinfo*/, Creature* /*creature*/) { }
+    virtual void OnCreatureRemoveWorld(Creature* /*creature*/) { }
+};
+
+class AllMapScript
+{
+public:
+    explicit AllMapScript(char const* /*name*/) { }
+    virtual ~AllMapScript() = default;
+
+    virtual void OnMapUpdate(Map* /*map*/, uint32 /*diff*/) { }
+};
+
+class PlayerScript
+{
+public:
+    explicit PlayerScript(char const* /*name*/) { }
+    virtual ~PlayerScript() = default;
+
+    virtual void OnPlayerLogin(Player* /*player*/) { }
+    virtual void OnPlayerLogout(Player* /*player*/) { }
+    virtual void OnPlayerUpdateZone(Player* /*player*/, uint32 /*newZone*/, uint32 /*newArea*/) { }
+};
+
+class UnitScript
+{
+public:
+    UnitScript(char const* /*name*/, bool /*addToScripts*/) { }
+    virtual ~UnitScript() = default;
+
+    virtual void ModifySpellDamageTaken(Unit* /*target*/, Unit* /*attacker*/, int32& /*damage*/, SpellInfo const* /*spellInfo*/) { }
+    virtual void ModifyPeriodicDamageAurasTick(Unit* /*target*/, Unit* /*attacker*/, uint32& /*damage*/, SpellInfo const* /*spellInfo*/) { }
+    virtual void ModifyMeleeDamage(Unit* /*target*/, Unit* /*attacker*/, uint32& /*damage*/) { }
+    virtual void ModifyHealReceived(Unit* /*target*/, Unit* /*healer*/, uint32& /*heal*/, SpellInfo const* /*spellInfo*/) { }
+};
+
+class CommandScript
+{
+public:
+    explicit CommandScript(char const* /*name*/) { }
+    virtual ~CommandScript() = default;
+
+    virtual Acore::ChatCommands::ChatCommandTable GetCommands() const = 0;
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef OUTDOOR_SCALING_MOCK_SHAREDDEFINES_H
+#define OUTDOOR_SCALING_MOCK_SHAREDDEFINES_H
+
+#include "Define.h"
+
+enum CreatureEliteType
+{
+    CREATURE_ELITE_NORMAL    = 0,
+    CREATURE_ELITE_ELITE     = 1,
+    CREATURE_ELITE_RAREELITE = 2,
+    CREATURE_ELITE_WORLDBOSS = 3,
+    CREATURE_ELITE_RARE      = 4
+};
+
+enum WeaponAttackType : uint8
+{
+    BASE_ATTACK   = 0,
+    OFF_ATTACK    = 1,
+    RANGED_ATTACK = 2,
+    MAX_ATTACK
+};
+
+enum WeaponDamageRange
+{
+    MINDAMAGE,
+    MAXDAMAGE
+};
+
+enum UnitMods
+{
+    UNIT_MOD_HEALTH
+};
+
+enum UnitModifierFlatType
+{
+    BASE_VALUE
+};
+
+enum TrinityStrings
+{
+    LANG_SELECT_CREATURE = 200
+};
+
+#endif
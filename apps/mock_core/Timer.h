@@ -0,0 +1,17 @@
+#ifndef OUTDOOR_SCALING_MOCK_TIMER_H
+#define OUTDOOR_SCALING_MOCK_TIMER_H
+
+#include <ctime>
+
+namespace Acore::Time
+{
+    // Server local time.
+    inline std::tm TimeBreakdown(time_t time)
+    {
+        std::tm result{};
+        localtime_r(&time, &result);
+        return result;
+    }
+}
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef OUTDOOR_SCALING_MOCK_TYPECONTAINER_H
+#define OUTDOOR_SCALING_MOCK_TYPECONTAINER_H
+
+#include <unordered_map>
+
+template<class OBJECT, class KEY_TYPE>
+struct ContainerUnorderedMap
+{
+    std::unordered_map<KEY_TYPE, OBJECT*> _element;
+};
+
+// The core's container keeps one map per stored object type; the mock only
+// stores one type.
+template<class OBJECT, class KEY_TYPE>
+class TypeUnorderedMapContainer
+{
+public:
+    ContainerUnorderedMap<OBJECT, KEY_TYPE>& GetElements() { return _elements; }
+    ContainerUnorderedMap<OBJECT, KEY_TYPE> const& GetElements() const { return _elements; }
+
+private:
+    ContainerUnorderedMap<OBJECT, KEY_TYPE> _elements;
+};
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef OUTDOOR_SCALING_MOCK_TYPECONTAINERVISITOR_H
+#define OUTDOOR_SCALING_MOCK_TYPECONTAINERVISITOR_H
+
+#include "TypeContainer.h"
+
+template<class VISITOR, class TYPE_CONTAINER>
+class TypeContainerVisitor
+{
+public:
+    explicit TypeContainerVisitor(VISITOR& v) : _visitor(v) { }
+
+    void Visit(TYPE_CONTAINER& c) { _visitor.Visit(c.GetElements()._element); }
+
+private:
+    VISITOR& _visitor;
+};
+
+#endif
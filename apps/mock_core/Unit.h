@@ -0,0 +1,89 @@
+#ifndef OUTDOOR_SCALING_MOCK_UNIT_H
+#define OUTDOOR_SCALING_MOCK_UNIT_H
+
+#include "DataMap.h"
+#include "ObjectGuid.h"
+#include "SharedDefines.h"
+
+#include <array>
+#include <string>
+
+class Creature;
+class Map;
+class Player;
+class SpellInfo;
+
+class WorldObject
+{
+public:
+    virtual ~WorldObject() = default;
+
+    Map* GetMap() const { return _map; }
+    void SetMap(Map* map) { _map = map; }
+    uint32 GetZoneId() const { return _zoneId; }
+    void SetZoneId(uint32 zoneId) { _zoneId = zoneId; }
+    uint32 GetAreaId() const { return _areaId; }
+    void SetAreaId(uint32 areaId) { _areaId = areaId; }
+    float GetPositionX() const { return _positionX; }
+    float GetPositionY() const { return _positionY; }
+    void Relocate(float x, float y) { _positionX = x; _positionY = y; }
+    uint32 GetEntry() const { return _entry; }
+    ObjectGuid GetGUID() const { return _guid; }
+    std::string const& GetName() const { return _name; }
+
+    DataMap CustomData;
+
+protected:
+    Map* _map = nullptr;
+    uint32 _zoneId = 0;
+    uint32 _areaId = 0;
+    float _positionX = 0.0f;
+    float _positionY = 0.0f;
+    uint32 _entry = 0;
+    ObjectGuid _guid;
+    std::string _name;
+};
+
+class Unit : public WorldObject
+{
+public:
+    bool IsCreature() const { return _isCreature; }
+    bool IsPlayer() const { return !_isCreature; }
+    Creature* ToCreature();
+    Player* ToPlayer();
+
+    bool IsPet() const { return _isPet; }
+    bool IsGuardian() const { return _isGuardian; }
+    bool IsAlive() const { return _health > 0; }
+
+    uint8 GetLevel() const { return _level; }
+    void SetLevel(uint8 level) { _level = level; }
+
+    uint32 GetCreateHealth() const { return _createHealth; }
+    void SetCreateHealth(uint32 value) { _createHealth = value; }
+    uint32 GetHealth() const { return _health; }
+    void SetHealth(uint32 value) { _health = value > _maxHealth ? _maxHealth : value; }
+    uint32 GetMaxHealth() const { return _maxHealth; }
+    void SetMaxHealth(uint32 value) { _maxHealth = value; if (_health > value) _health = value; }
+    float GetHealthPct() const { return _maxHealth ? 100.0f * float(_health) / float(_maxHealth) : 0.0f; }
+    uint32 CountPctFromMaxHealth(float pct) const { return uint32(float(_maxHealth) * pct / 100.0f); }
+
+    void SetStatFlatModifier(UnitMods /*unitMod*/, UnitModifierFlatType /*modifierType*/, float value) { _healthFlatModifier = value; }
+    void UpdateAllStats() { SetMaxHealth(uint32(_healthFlatModifier)); }
+
+    float GetWeaponDamageRange(WeaponAttackType attType, WeaponDamageRange type) const { return _weaponDamage[attType][type]; }
+    void SetBaseWeaponDamage(WeaponAttackType attType, WeaponDamageRange damageRange, float value) { _weaponDamage[attType][damageRange] = value; }
+
+protected:
+    bool _isCreature = false;
+    bool _isPet = false;
+    bool _isGuardian = false;
+    uint8 _level = 1;
+    uint32 _createHealth = 1;
+    uint32 _health = 1;
+    uint32 _maxHealth = 1;
+    float _healthFlatModifier = 1.0f;
+    std::array<std::array<float, 2>, MAX_ATTACK> _weaponDamage{};
+};
+
+#endif
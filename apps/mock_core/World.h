@@ -0,0 +1,42 @@
+#ifndef OUTDOOR_SCALING_MOCK_WORLD_H
+#define OUTDOOR_SCALING_MOCK_WORLD_H
+
+#include "Define.h"
+
+enum Rates
+{
+    RATE_CREATURE_NORMAL_HP,
+    RATE_CREATURE_ELITE_ELITE_HP,
+    RATE_CREATURE_ELITE_RAREELITE_HP,
+    RATE_CREATURE_ELITE_WORLDBOSS_HP,
+    RATE_CREATURE_ELITE_RARE_HP,
+    RATE_CREATURE_NORMAL_DAMAGE,
+    RATE_CREATURE_ELITE_ELITE_DAMAGE,
+    RATE_CREATURE_ELITE_RAREELITE_DAMAGE,
+    RATE_CREATURE_ELITE_WORLDBOSS_DAMAGE,
+    RATE_CREATURE_ELITE_RARE_DAMAGE,
+    RATE_CREATURE_NORMAL_SPELLDAMAGE,
+    RATE_CREATURE_ELITE_ELITE_SPELLDAMAGE,
+    RATE_CREATURE_ELITE_RAREELITE_SPELLDAMAGE,
+    RATE_CREATURE_ELITE_WORLDBOSS_SPELLDAMAGE,
+    RATE_CREATURE_ELITE_RARE_SPELLDAMAGE,
+    MAX_RATES
+};
+
+class World
+{
+public:
+    static World* instance();
+
+    World() { for (float& rate : _rates) rate = 1.0f; }
+
+    float getRate(Rates rate) const { return _rates[rate]; }
+    void setRate(Rates rate, float value) { _rates[rate] = value; }
+
+private:
+    float _rates[MAX_RATES];
+};
+
+#define sWorld World::instance()
+
+#endif
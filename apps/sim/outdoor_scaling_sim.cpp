@@ -0,0 +1,838 @@
+/*
+ * Outdoor scaling tuning simulator:
+ * - Replays a creature list exported with .os dump against one or more
+ *   candidate configs, through the module's own config parsing and
+ *   ComputeScaling, and reports the resulting HP and damage distributions
+ *   per expansion and rank, and per zone.
+ * - The first config is the baseline; every other one is diffed against it,
+ *   option by option and group by group.
+ * - Parsing and resolving are spread over all cores.
+ *
+ * Usage: outdoor_scaling_sim [options] <dump.csv> <baseline.conf[@Profile]> [candidate.conf[@Profile] ...]
+ *   --threads N  worker threads (default: all cores)
+ *   --zones      also print every zone's distribution for each config
+ *   --limit N    zone groups listed per diff, largest change first (default 40)
+ *   --world F    worldserver.conf whose Rate.Creature.* values the realm runs
+ *                with; a config file's own Rate.Creature.* lines win
+ *   @Profile     evaluate that scheduled profile instead of the base settings
+ *
+ * Offline there are no players and no database: population scaling sees empty
+ * zones and database overrides are not loaded.
+ */
+
+// The module keeps its logic in an anonymous namespace; compiling it into
+// this translation unit simulates exactly the code the worldserver runs.
+#include "mod_outdoor_scaling.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <thread>
+#include <unordered_map>
+
+namespace
+{
+    // Continents as the simulator sees them; other maps in a dump are
+    // instanced or unknown and left out.
+    struct ContinentInfo
+    {
+        uint32 mapId;
+        uint32 expansion;
+    };
+
+    constexpr std::array<ContinentInfo, 4> Continents = { {
+        { 0, 0 },   // Eastern Kingdoms
+        { 1, 0 },   // Kalimdor
+        { 530, 1 }, // Outland
+        { 571, 2 }  // Northrend
+    } };
+
+    constexpr std::array<char const*, MAX_OUTDOOR_RANKS> RankNames = { "Normal", "Elite", "RareElite", "WorldBoss", "Rare" };
+
+    // Columns the simulator reads, found by name in the header so that dumps
+    // with extra columns still load.
+    enum DumpColumn : uint8
+    {
+        COLUMN_MAP,
+        COLUMN_ENTRY,
+        COLUMN_LEVEL,
+        COLUMN_RANK,
+        COLUMN_ZONE,
+        COLUMN_AREA,
+        COLUMN_X,
+        COLUMN_Y,
+        COLUMN_SOURCE,
+        COLUMN_APPLIED_HEALTH_FACTOR,
+        COLUMN_APPLIED_DAMAGE_FACTOR,
+        COLUMN_MAX_HEALTH,
+        COLUMN_MIN_DAMAGE,
+        COLUMN_MAX_DAMAGE,
+        MAX_DUMP_COLUMNS
+    };
+
+    constexpr std::array<std::string_view, MAX_DUMP_COLUMNS> ColumnNames = {
+        "map", "entry", "level", "rank", "zone", "area", "x", "y", "source",
+        "applied_health_factor", "applied_damage_factor", "max_health", "min_damage", "max_damage"
+    };
+
+    constexpr std::size_t MaxFields = 32;
+
+    // A dumped outdoor creature with its stats as the core gave them, world
+    // rates included, before the module's factors.
+    struct SpawnRecord
+    {
+        ScalingQuery query;
+        uint8 expansion = 0;
+        float baseHealth = 0.0f;
+        float baseDamage = 0.0f;
+    };
+
+    struct Dump
+    {
+        std::vector<SpawnRecord> records;
+        uint64 skipped = 0;
+        uint64 rejected = 0;
+    };
+
+    struct SimWorld
+    {
+        std::array<MapEntry, Continents.size()> entries;
+        std::vector<std::unique_ptr<Map>> maps;
+
+        SimWorld()
+        {
+            for (std::size_t i = 0; i < Continents.size(); ++i)
+            {
+                entries[i] = { Continents[i].mapId, Continents[i].expansion, true };
+                maps.push_back(std::make_unique<Map>(Continents[i].mapId, &entries[i], false));
+            }
+        }
+
+        Map* Find(uint32 mapId) const
+        {
+            for (std::size_t i = 0; i < Continents.size(); ++i)
+                if (Continents[i].mapId == mapId)
+                    return maps[i].get();
+
+            return nullptr;
+        }
+    };
+
+    // Runs body(begin, end) over [0, count) split into one contiguous range per thread.
+    template<class Body>
+    void ParallelFor(std::size_t count, uint32 threads, Body&& body)
+    {
+        std::size_t const step = (count + threads - 1) / threads;
+        std::vector<std::thread> workers;
+        for (std::size_t begin = 0; begin < count; begin += step)
+            workers.emplace_back([&body, begin, end = std::min(count, begin + step)]() { body(begin, end); });
+
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    double MillisecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::string_view Trim(std::string_view text)
+    {
+        while (!text.empty() && IsRowSpace(text.front()))
+            text.remove_prefix(1);
+
+        while (!text.empty() && IsRowSpace(text.back()))
+            text.remove_suffix(1);
+
+        return text;
+    }
+
+    std::size_t SplitFields(std::string_view line, std::array<std::string_view, MaxFields>& fields)
+    {
+        std::size_t count = 0;
+        while (count < MaxFields)
+        {
+            std::size_t comma = line.find(',');
+            fields[count++] = line.substr(0, comma);
+            if (comma == std::string_view::npos)
+                break;
+
+            line.remove_prefix(comma + 1);
+        }
+
+        return count;
+    }
+
+    bool ParseSource(std::string_view text, OutdoorScalingInfo::Source& source)
+    {
+        static std::array<std::string, MAX_SCALING_SOURCES> const names = []()
+        {
+            std::array<std::string, MAX_SCALING_SOURCES> result;
+            for (uint8 i = 0; i < MAX_SCALING_SOURCES; ++i)
+                result[i] = SourceToString(OutdoorScalingInfo::Source(i));
+
+            return result;
+        }();
+
+        for (uint8 i = 0; i < MAX_SCALING_SOURCES; ++i)
+        {
+            if (text == names[i])
+            {
+                source = OutdoorScalingInfo::Source(i);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    enum class RowResult
+    {
+        Loaded,
+        Skipped,
+        Rejected
+    };
+
+    RowResult ParseDumpRow(std::string_view line, std::array<std::size_t, MAX_DUMP_COLUMNS> const& columns, SimWorld const& world, SpawnRecord& record)
+    {
+        std::array<std::string_view, MaxFields> fields;
+        std::size_t fieldCount = SplitFields(line, fields);
+        for (std::size_t column : columns)
+            if (column >= fieldCount)
+                return RowResult::Rejected;
+
+        uint32 mapId = 0;
+        if (!ParseNumber(fields[columns[COLUMN_MAP]], mapId))
+            return RowResult::Rejected;
+
+        Map* map = world.Find(mapId);
+        if (!map)
+            return RowResult::Skipped;
+
+        uint32 level = 0;
+        uint32 rank = 0;
+        uint32 maxHealth = 0;
+        float healthFactor = 1.0f;
+        float damageFactor = 1.0f;
+        float minDamage = 0.0f;
+        float maxDamage = 0.0f;
+        OutdoorScalingInfo::Source source = OutdoorScalingInfo::Source::None;
+
+        ScalingQuery& query = record.query;
+        query.map = map;
+        if (!ParseNumber(fields[columns[COLUMN_ENTRY]], query.entry) ||
+            !ParseNumber(fields[columns[COLUMN_LEVEL]], level) ||
+            !ParseNumber(fields[columns[COLUMN_RANK]], rank) ||
+            !ParseNumber(fields[columns[COLUMN_ZONE]], query.zoneId) ||
+            !ParseNumber(fields[columns[COLUMN_AREA]], query.areaId) ||
+            !ParseNumber(fields[columns[COLUMN_X]], query.x) ||
+            !ParseNumber(fields[columns[COLUMN_Y]], query.y) ||
+            !ParseSource(fields[columns[COLUMN_SOURCE]], source) ||
+            !ParseNumber(fields[columns[COLUMN_APPLIED_HEALTH_FACTOR]], healthFactor) ||
+            !ParseNumber(fields[columns[COLUMN_APPLIED_DAMAGE_FACTOR]], damageFactor) ||
+            !ParseNumber(fields[columns[COLUMN_MAX_HEALTH]], maxHealth) ||
+            !ParseNumber(fields[columns[COLUMN_MIN_DAMAGE]], minDamage) ||
+            !ParseNumber(fields[columns[COLUMN_MAX_DAMAGE]], maxDamage))
+            return RowResult::Rejected;
+
+        query.level = uint8(std::min<uint32>(level, 255));
+        query.rank = ClampRank(uint8(std::min<uint32>(rank, 255)));
+        query.isPetOrGuardian = source == OutdoorScalingInfo::Source::PetOrGuardian;
+        record.expansion = ClampExpansion(map->GetEntry()->Expansion());
+
+        // Undo the factors baked into the stats when the dump was taken. They
+        // are the multipliers with the world rates divided out, and differ
+        // from the cached multipliers until a re-resolve is re-applied.
+        if (healthFactor <= 0.0f || damageFactor <= 0.0f)
+            return RowResult::Rejected;
+
+        record.baseHealth = float(maxHealth) / healthFactor;
+        record.baseDamage = (minDamage + maxDamage) * 0.5f / damageFactor;
+        return RowResult::Loaded;
+    }
+
+    // Reads the whole dump, then parses it in one line-aligned slice per thread.
+    bool LoadDump(std::string const& path, SimWorld const& world, uint32 threads, Dump& dump)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            std::fprintf(stderr, "could not open dump '%s'\n", path.c_str());
+            return false;
+        }
+
+        std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        std::string_view body(text);
+
+        std::size_t headerEnd = body.find('\n');
+        std::array<std::string_view, MaxFields> header;
+        std::size_t headerCount = SplitFields(Trim(body.substr(0, headerEnd)), header);
+        body.remove_prefix(headerEnd == std::string_view::npos ? body.size() : headerEnd + 1);
+
+        std::array<std::size_t, MAX_DUMP_COLUMNS> columns;
+        for (uint8 column = 0; column < MAX_DUMP_COLUMNS; ++column)
+        {
+            auto found = std::find(header.begin(), header.begin() + headerCount, ColumnNames[column]);
+            if (found == header.begin() + headerCount)
+            {
+                std::fprintf(stderr, "dump '%s' has no '%.*s' column; export it with .os dump\n",
+                    path.c_str(), int(ColumnNames[column].size()), ColumnNames[column].data());
+                return false;
+            }
+
+            columns[column] = std::size_t(found - header.begin());
+        }
+
+        std::vector<std::string_view> slices;
+        std::size_t const sliceSize = body.size() / threads + 1;
+        while (!body.empty())
+        {
+            std::size_t end = body.find('\n', std::min(sliceSize, body.size() - 1));
+            end = end == std::string_view::npos ? body.size() : end + 1;
+            slices.push_back(body.substr(0, end));
+            body.remove_prefix(end);
+        }
+
+        std::vector<Dump> parts(slices.size());
+        ParallelFor(slices.size(), uint32(slices.size()), [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t slice = begin; slice < end; ++slice)
+            {
+                std::string_view input = slices[slice];
+                Dump& part = parts[slice];
+                part.records.reserve(std::size_t(std::count(input.begin(), input.end(), '\n')) + 1);
+
+                while (!input.empty())
+                {
+                    std::size_t newline = input.find('\n');
+                    std::string_view line = Trim(input.substr(0, newline));
+                    input.remove_prefix(newline == std::string_view::npos ? input.size() : newline + 1);
+                    if (line.empty())
+                        continue;
+
+                    SpawnRecord record;
+                    switch (ParseDumpRow(line, columns, world, record))
+                    {
+                        case RowResult::Loaded:   part.records.push_back(record); break;
+                        case RowResult::Skipped:  ++part.skipped; break;
+                        case RowResult::Rejected: ++part.rejected; break;
+                    }
+                }
+            }
+        });
+
+        std::size_t total = 0;
+        for (Dump const& part : parts)
+            total += part.records.size();
+
+        dump.records.reserve(total);
+        for (Dump& part : parts)
+        {
+            dump.records.insert(dump.records.end(), part.records.begin(), part.records.end());
+            dump.skipped += part.skipped;
+            dump.rejected += part.rejected;
+        }
+
+        return true;
+    }
+
+    using ConfigOptions = std::map<std::string, std::string>;
+
+    // Reads "Key = Value" lines of a worldserver style config file.
+    bool LoadConfigFile(std::string const& path, ConfigOptions& options)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            std::fprintf(stderr, "could not open config '%s'\n", path.c_str());
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::string_view content(line);
+            content = content.substr(0, content.find('#'));
+
+            std::size_t equals = content.find('=');
+            if (equals == std::string_view::npos)
+                continue;
+
+            std::string_view key = Trim(content.substr(0, equals));
+            std::string_view value = Trim(content.substr(equals + 1));
+            if (value.size() >= 2 && value.front() == '"' && value.back() == '"')
+                value = value.substr(1, value.size() - 2);
+
+            options[std::string(key)] = std::string(value);
+        }
+
+        return true;
+    }
+
+    struct Candidate
+    {
+        std::string label;
+        ConfigOptions options;
+        std::shared_ptr<OutdoorScalingConfig const> config;
+        // Per record, in dump order.
+        std::vector<float> health;
+        std::vector<float> damage;
+    };
+
+    // Sets the core's Rate.Creature.* values the way World::LoadConfigSettings
+    // reads them; the factor tables divide them out.
+    void LoadWorldRates(ConfigOptions const& options)
+    {
+        static constexpr std::pair<Rates, char const*> rates[] =
+        {
+            { RATE_CREATURE_NORMAL_HP,                  "Rate.Creature.Normal.HP" },
+            { RATE_CREATURE_ELITE_ELITE_HP,             "Rate.Creature.Elite.Elite.HP" },
+            { RATE_CREATURE_ELITE_RAREELITE_HP,         "Rate.Creature.Elite.RAREELITE.HP" },
+            { RATE_CREATURE_ELITE_WORLDBOSS_HP,         "Rate.Creature.Elite.WORLDBOSS.HP" },
+            { RATE_CREATURE_ELITE_RARE_HP,              "Rate.Creature.Elite.RARE.HP" },
+            { RATE_CREATURE_NORMAL_DAMAGE,              "Rate.Creature.Normal.Damage" },
+            { RATE_CREATURE_ELITE_ELITE_DAMAGE,         "Rate.Creature.Elite.Elite.Damage" },
+            { RATE_CREATURE_ELITE_RAREELITE_DAMAGE,     "Rate.Creature.Elite.RAREELITE.Damage" },
+            { RATE_CREATURE_ELITE_WORLDBOSS_DAMAGE,     "Rate.Creature.Elite.WORLDBOSS.Damage" },
+            { RATE_CREATURE_ELITE_RARE_DAMAGE,          "Rate.Creature.Elite.RARE.Damage" },
+            { RATE_CREATURE_NORMAL_SPELLDAMAGE,         "Rate.Creature.Normal.SpellDamage" },
+            { RATE_CREATURE_ELITE_ELITE_SPELLDAMAGE,    "Rate.Creature.Elite.Elite.SpellDamage" },
+            { RATE_CREATURE_ELITE_RAREELITE_SPELLDAMAGE, "Rate.Creature.Elite.RAREELITE.SpellDamage" },
+            { RATE_CREATURE_ELITE_WORLDBOSS_SPELLDAMAGE, "Rate.Creature.Elite.WORLDBOSS.SpellDamage" },
+            { RATE_CREATURE_ELITE_RARE_SPELLDAMAGE,     "Rate.Creature.Elite.RARE.SpellDamage" }
+        };
+
+        for (auto const& [rate, name] : rates)
+        {
+            float value = 1.0f;
+            auto itr = options.find(name);
+            if (itr != options.end() && !ParseNumber(std::string_view(itr->second), value))
+                std::fprintf(stderr, "ignoring %s = \"%s\"; not a number\n", name, itr->second.c_str());
+
+            sWorld->setRate(rate, value);
+        }
+    }
+
+    // Builds the snapshot exactly as a worldserver config load would, with
+    // the realm's world rates from worldOptions under the file's own.
+    bool BuildCandidate(std::string const& argument, ConfigOptions const& worldOptions, OutdoorScaling_WorldScript& worldScript, Candidate& candidate)
+    {
+        candidate.label = argument;
+
+        std::size_t at = argument.rfind('@');
+        std::string path = argument.substr(0, at);
+        std::string profileName = at == std::string::npos ? std::string() : argument.substr(at + 1);
+
+        for (auto const& [key, value] : worldOptions)
+            if (key.starts_with("Rate.Creature."))
+                candidate.options[key] = value;
+
+        if (!LoadConfigFile(path, candidate.options))
+            return false;
+
+        LoadWorldRates(candidate.options);
+        sConfigMgr->Clear();
+        for (auto const& [key, value] : candidate.options)
+            sConfigMgr->SetOption(key, value);
+
+        // No world database here, and the override report is not needed.
+        sConfigMgr->SetOption("OutdoorScaling.Database.Enable", "0");
+        sConfigMgr->SetOption("OutdoorScaling.Validate.Enable", "0");
+        worldScript.OnAfterConfigLoad(false);
+
+        OutdoorScalingConfig const& base = gConfigStore.GetBase();
+        uint32 profile = 0;
+        if (!profileName.empty())
+        {
+            for (uint32 i = 1; i <= base.profiles.size() && !profile; ++i)
+                if (ProfileAt(base, i).profileName == profileName)
+                    profile = i;
+
+            if (!profile)
+            {
+                std::fprintf(stderr, "config '%s' has no profile '%s'\n", path.c_str(), profileName.c_str());
+                return false;
+            }
+        }
+
+        candidate.config = std::make_shared<OutdoorScalingConfig const>(ProfileAt(base, profile));
+        return true;
+    }
+
+    void Resolve(std::vector<SpawnRecord> const& records, uint32 threads, Candidate& candidate)
+    {
+        candidate.health.resize(records.size());
+        candidate.damage.resize(records.size());
+        OutdoorScalingConfig const& config = *candidate.config;
+
+        ParallelFor(records.size(), threads, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                // The same factors the spawn hook applies: the multiplier with
+                // the world rate divided out, or 1 to keep the world rate.
+                ScalingResult scaling = ComputeScaling(config, records[i].query);
+                bool scaled = IsScaledSource(scaling.source);
+                candidate.health[i] = records[i].baseHealth * (scaled ? scaling.factors[SCALING_STAT_HEALTH] : 1.0f);
+                candidate.damage[i] = records[i].baseDamage * (scaled ? scaling.factors[SCALING_STAT_DAMAGE] : 1.0f);
+            }
+        });
+    }
+
+    // Records bucketed by a group key, CSR style.
+    struct Groups
+    {
+        std::vector<uint64> keys;
+        std::vector<uint32> start;
+        std::vector<uint32> members;
+    };
+
+    template<class KeyOf>
+    Groups BuildGroups(std::vector<SpawnRecord> const& records, KeyOf&& keyOf)
+    {
+        Groups groups;
+        std::vector<uint32> groupOf(records.size());
+        std::unordered_map<uint64, uint32> index;
+        for (std::size_t i = 0; i < records.size(); ++i)
+        {
+            auto [itr, inserted] = index.try_emplace(keyOf(records[i]), uint32(index.size()));
+            groupOf[i] = itr->second;
+        }
+
+        // Renumber in key order so every table prints sorted.
+        std::vector<std::pair<uint64, uint32>> sorted(index.begin(), index.end());
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<uint32> order(sorted.size());
+        for (uint32 i = 0; i < sorted.size(); ++i)
+        {
+            groups.keys.push_back(sorted[i].first);
+            order[sorted[i].second] = i;
+        }
+
+        groups.start.assign(groups.keys.size() + 1, 0);
+        for (uint32& group : groupOf)
+        {
+            group = order[group];
+            ++groups.start[group + 1];
+        }
+
+        for (std::size_t i = 1; i < groups.start.size(); ++i)
+            groups.start[i] += groups.start[i - 1];
+
+        groups.members.resize(records.size());
+        std::vector<uint32> cursor(groups.start.begin(), groups.start.end() - 1);
+        for (uint32 i = 0; i < groupOf.size(); ++i)
+            groups.members[cursor[groupOf[i]]++] = i;
+
+        return groups;
+    }
+
+    struct Distribution
+    {
+        double mean = 0.0;
+        float p50 = 0.0f;
+        float p90 = 0.0f;
+        float max = 0.0f;
+    };
+
+    struct GroupStats
+    {
+        uint32 count = 0;
+        Distribution health;
+        Distribution damage;
+        // Members whose HP or damage differs from the baseline.
+        uint32 changed = 0;
+    };
+
+    Distribution Describe(std::vector<float>& values)
+    {
+        Distribution distribution;
+        if (values.empty())
+            return distribution;
+
+        double sum = 0.0;
+        for (float value : values)
+            sum += value;
+
+        distribution.mean = sum / double(values.size());
+        auto p50 = values.begin() + std::ptrdiff_t(values.size() / 2);
+        std::nth_element(values.begin(), p50, values.end());
+        distribution.p50 = *p50;
+        auto p90 = values.begin() + std::ptrdiff_t(values.size() * 9 / 10);
+        std::nth_element(p50, p90, values.end());
+        distribution.p90 = *p90;
+        distribution.max = *std::max_element(p90, values.end());
+        return distribution;
+    }
+
+    bool Differs(float a, float b)
+    {
+        return std::fabs(a - b) > 1e-4f * std::max(std::fabs(a), std::fabs(b));
+    }
+
+    std::vector<GroupStats> Describe(Groups const& groups, Candidate const& candidate, Candidate const& baseline, uint32 threads)
+    {
+        std::vector<GroupStats> stats(groups.keys.size());
+        ParallelFor(groups.keys.size(), threads, [&](std::size_t begin, std::size_t end)
+        {
+            std::vector<float> values;
+            for (std::size_t group = begin; group < end; ++group)
+            {
+                GroupStats& out = stats[group];
+                out.count = groups.start[group + 1] - groups.start[group];
+
+                values.clear();
+                for (uint32 i = groups.start[group]; i < groups.start[group + 1]; ++i)
+                {
+                    uint32 record = groups.members[i];
+                    values.push_back(candidate.health[record]);
+                    if (Differs(candidate.health[record], baseline.health[record]) || Differs(candidate.damage[record], baseline.damage[record]))
+                        ++out.changed;
+                }
+
+                out.health = Describe(values);
+
+                values.clear();
+                for (uint32 i = groups.start[group]; i < groups.start[group + 1]; ++i)
+                    values.push_back(candidate.damage[groups.members[i]]);
+
+                out.damage = Describe(values);
+            }
+        });
+
+        return stats;
+    }
+
+    uint64 ZoneKey(SpawnRecord const& record)
+    {
+        return uint64(record.query.zoneId) << 16 | uint64(record.expansion) << 8 | record.query.rank;
+    }
+
+    uint64 RankKey(SpawnRecord const& record)
+    {
+        return uint64(record.expansion) << 8 | record.query.rank;
+    }
+
+    void PrintGroupLabel(uint64 key, bool withZone)
+    {
+        if (withZone)
+            std::printf("%6u ", uint32(key >> 16));
+
+        std::printf("%3u %-9s", uint32(key >> 8 & 0xFF), RankNames[key & 0xFF]);
+    }
+
+    void PrintDistributions(Groups const& groups, std::vector<GroupStats> const& stats, bool withZone)
+    {
+        if (withZone)
+            std::printf("%6s ", "zone");
+
+        std::printf("%3s %-9s %10s %10s %10s %10s %10s %9s %9s %9s %9s\n",
+            "exp", "rank", "creatures", "HP mean", "HP p50", "HP p90", "HP max", "Dmg mean", "Dmg p50", "Dmg p90", "Dmg max");
+
+        for (std::size_t group = 0; group < groups.keys.size(); ++group)
+        {
+            GroupStats const& s = stats[group];
+            PrintGroupLabel(groups.keys[group], withZone);
+            std::printf(" %10u %10.0f %10.0f %10.0f %10.0f %10.1f %9.1f %9.1f %9.1f\n", s.count,
+                s.health.mean, s.health.p50, s.health.p90, s.health.max,
+                s.damage.mean, s.damage.p50, s.damage.p90, s.damage.max);
+        }
+    }
+
+    double PercentChange(double before, double after)
+    {
+        return before != 0.0 ? (after / before - 1.0) * 100.0 : 0.0;
+    }
+
+    void PrintOptionDiff(ConfigOptions const& baseline, ConfigOptions const& candidate)
+    {
+        auto isModuleOption = [](std::string const& key) { return key.starts_with("OutdoorScaling.") || key.starts_with("Rate.Creature."); };
+
+        uint32 differences = 0;
+        for (auto const& [key, value] : candidate)
+        {
+            if (!isModuleOption(key))
+                continue;
+
+            auto itr = baseline.find(key);
+            if (itr == baseline.end())
+                std::printf("  + %s = \"%s\"\n", key.c_str(), value.c_str());
+            else if (itr->second != value)
+                std::printf("  ~ %s = \"%s\" -> \"%s\"\n", key.c_str(), itr->second.c_str(), value.c_str());
+            else
+                continue;
+
+            ++differences;
+        }
+
+        for (auto const& [key, value] : baseline)
+        {
+            if (isModuleOption(key) && !candidate.contains(key))
+            {
+                std::printf("  - %s = \"%s\"\n", key.c_str(), value.c_str());
+                ++differences;
+            }
+        }
+
+        if (!differences)
+            std::printf("  (no OutdoorScaling.* or Rate.Creature.* option differs)\n");
+    }
+
+    void PrintDiff(Groups const& rankGroups, std::vector<GroupStats> const& baseRanks, std::vector<GroupStats> const& candidateRanks,
+        Groups const& zoneGroups, std::vector<GroupStats> const& baseZones, std::vector<GroupStats> const& candidateZones, uint32 limit)
+    {
+        uint64 total = 0;
+        uint64 changed = 0;
+        for (GroupStats const& s : candidateRanks)
+        {
+            total += s.count;
+            changed += s.changed;
+        }
+
+        std::printf("creatures changed: %llu of %llu (%.1f%%)\n\n", static_cast<unsigned long long>(changed),
+            static_cast<unsigned long long>(total), total ? double(changed) * 100.0 / double(total) : 0.0);
+
+        std::printf("%3s %-9s %10s %10s %12s %12s %8s %10s %10s %8s\n",
+            "exp", "rank", "creatures", "changed", "HP mean", "-> HP mean", "HP %", "Dmg mean", "-> Dmg", "Dmg %");
+        for (std::size_t group = 0; group < rankGroups.keys.size(); ++group)
+        {
+            GroupStats const& before = baseRanks[group];
+            GroupStats const& after = candidateRanks[group];
+            PrintGroupLabel(rankGroups.keys[group], false);
+            std::printf(" %10u %10u %12.0f %12.0f %+7.1f%% %10.1f %10.1f %+7.1f%%\n", after.count, after.changed,
+                before.health.mean, after.health.mean, PercentChange(before.health.mean, after.health.mean),
+                before.damage.mean, after.damage.mean, PercentChange(before.damage.mean, after.damage.mean));
+        }
+
+        std::vector<std::size_t> changedZones;
+        for (std::size_t group = 0; group < zoneGroups.keys.size(); ++group)
+            if (candidateZones[group].changed)
+                changedZones.push_back(group);
+
+        auto magnitude = [&](std::size_t group)
+        {
+            return std::fabs(PercentChange(baseZones[group].health.mean, candidateZones[group].health.mean)) +
+                std::fabs(PercentChange(baseZones[group].damage.mean, candidateZones[group].damage.mean));
+        };
+
+        std::stable_sort(changedZones.begin(), changedZones.end(), [&](std::size_t a, std::size_t b) { return magnitude(a) > magnitude(b); });
+
+        std::printf("\nzone groups changed: %zu of %zu", changedZones.size(), zoneGroups.keys.size());
+        if (changedZones.size() > limit)
+            std::printf(", largest %u shown", limit);
+
+        std::printf("\n");
+        if (changedZones.empty())
+            return;
+
+        std::printf("%6s %3s %-9s %10s %10s %12s %12s %8s %10s %10s %8s\n",
+            "zone", "exp", "rank", "creatures", "changed", "HP mean", "-> HP mean", "HP %", "Dmg mean", "-> Dmg", "Dmg %");
+        for (std::size_t i = 0; i < changedZones.size() && i < limit; ++i)
+        {
+            std::size_t group = changedZones[i];
+            GroupStats const& before = baseZones[group];
+            GroupStats const& after = candidateZones[group];
+            PrintGroupLabel(zoneGroups.keys[group], true);
+            std::printf(" %10u %10u %12.0f %12.0f %+7.1f%% %10.1f %10.1f %+7.1f%%\n", after.count, after.changed,
+                before.health.mean, after.health.mean, PercentChange(before.health.mean, after.health.mean),
+                before.damage.mean, after.damage.mean, PercentChange(before.damage.mean, after.damage.mean));
+        }
+    }
+
+    int Usage()
+    {
+        std::fprintf(stderr, "usage: outdoor_scaling_sim [--threads N] [--zones] [--limit N] [--world worldserver.conf] <dump.csv> <baseline.conf[@Profile]> [candidate.conf[@Profile] ...]\n");
+        return 1;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint32 threads = std::max(1u, std::thread::hardware_concurrency());
+    uint32 limit = 40;
+    bool printZones = false;
+    ConfigOptions worldOptions;
+    std::vector<std::string> positional;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string_view argument(argv[i]);
+        if (argument == "--threads" && i + 1 < argc)
+            threads = std::max(1, std::atoi(argv[++i]));
+        else if (argument == "--limit" && i + 1 < argc)
+            limit = uint32(std::max(0, std::atoi(argv[++i])));
+        else if (argument == "--zones")
+            printZones = true;
+        else if (argument == "--world" && i + 1 < argc)
+        {
+            if (!LoadConfigFile(argv[++i], worldOptions))
+                return 1;
+        }
+        else if (argument.starts_with("--"))
+            return Usage();
+        else
+            positional.emplace_back(argument);
+    }
+
+    if (positional.size() < 2)
+        return Usage();
+
+    SimWorld world;
+    Dump dump;
+
+    auto start = std::chrono::steady_clock::now();
+    if (!LoadDump(positional[0], world, threads, dump))
+        return 1;
+
+    std::printf("dump: %zu outdoor creatures loaded, %llu on other maps skipped, %llu rows rejected (%.0f ms, %u threads)\n",
+        dump.records.size(), static_cast<unsigned long long>(dump.skipped), static_cast<unsigned long long>(dump.rejected),
+        MillisecondsSince(start), threads);
+
+    if (dump.records.empty())
+        return 1;
+
+    OutdoorScaling_WorldScript worldScript;
+    std::vector<Candidate> candidates(positional.size() - 1);
+    for (std::size_t i = 0; i < candidates.size(); ++i)
+    {
+        if (!BuildCandidate(positional[i + 1], worldOptions, worldScript, candidates[i]))
+            return 1;
+
+        start = std::chrono::steady_clock::now();
+        Resolve(dump.records, threads, candidates[i]);
+        double ms = MillisecondsSince(start);
+        std::printf("config %s: %zu resolves in %.0f ms (%.1f M/s)\n", candidates[i].label.c_str(), dump.records.size(), ms,
+            double(dump.records.size()) / ms / 1000.0);
+    }
+
+    Groups rankGroups = BuildGroups(dump.records, RankKey);
+    Groups zoneGroups = BuildGroups(dump.records, ZoneKey);
+
+    Candidate const& baseline = candidates.front();
+    std::vector<GroupStats> baseRanks = Describe(rankGroups, baseline, baseline, threads);
+    std::vector<GroupStats> baseZones = Describe(zoneGroups, baseline, baseline, threads);
+
+    for (Candidate const& candidate : candidates)
+    {
+        std::printf("\n== %s ==\n", candidate.label.c_str());
+        std::vector<GroupStats> ranks = Describe(rankGroups, candidate, baseline, threads);
+        PrintDistributions(rankGroups, ranks, false);
+
+        if (printZones)
+        {
+            std::printf("\n");
+            PrintDistributions(zoneGroups, Describe(zoneGroups, candidate, baseline, threads), true);
+        }
+
+        if (&candidate == &baseline)
+            continue;
+
+        std::printf("\n-- %s vs %s --\n", candidate.label.c_str(), baseline.label.c_str());
+        PrintOptionDiff(baseline.options, candidate.options);
+        std::printf("\n");
+        PrintDiff(rankGroups, baseRanks, ranks, zoneGroups, baseZones, Describe(zoneGroups, candidate, baseline, threads), limit);
+    }
+
+    return 0;
+}
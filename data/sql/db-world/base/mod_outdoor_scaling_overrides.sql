@@ -0,0 +1,21 @@
+-- Zone, creature, area and region overrides for mod-outdoor-scaling, read when OutdoorScaling.Database.Enable = 1.
+-- Type: 0 = zone (Id is a zone id), 1 = creature (Id is a creature_template entry), 2 = area (Id is an AreaTable id),
+--       3 = region (Id numbers the region; MapId and X1, Y1, X2, Y2, Radius give its bounds).
+-- Regions: a circle of Radius yards around (X1, Y1) when Radius > 0, otherwise the rectangle from (X1, Y1) to (X2, Y2).
+-- Where regions overlap, the highest Id wins. The bounds columns are ignored for the other types.
+-- Multipliers must be > 0. Overrides from the config file win over rows with the same Type and Id, and config regions
+-- win over database regions they overlap.
+CREATE TABLE IF NOT EXISTS `mod_outdoor_scaling_overrides` (
+  `Type` TINYINT UNSIGNED NOT NULL,
+  `Id` INT UNSIGNED NOT NULL,
+  `HealthMult` FLOAT NOT NULL DEFAULT 1,
+  `DamageMult` FLOAT NOT NULL DEFAULT 1,
+  `MapId` INT UNSIGNED NOT NULL DEFAULT 0,
+  `X1` FLOAT NOT NULL DEFAULT 0,
+  `Y1` FLOAT NOT NULL DEFAULT 0,
+  `X2` FLOAT NOT NULL DEFAULT 0,
+  `Y2` FLOAT NOT NULL DEFAULT 0,
+  `Radius` FLOAT NOT NULL DEFAULT 0,
+  `Comment` VARCHAR(255) NOT NULL DEFAULT '',
+  PRIMARY KEY (`Type`, `Id`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COLLATE=utf8mb4_unicode_ci;
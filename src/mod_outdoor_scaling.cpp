@@ -1,338 +1,3722 @@
 /*
  * Outdoor scaling module:
- * - Per-continent defaults (Vanilla/BC/WotLK) for outdoor creatures only.
- * - Optional per-zone and per-creature overrides that trump continent values.
- * - Commands: .os mapstat / .os creaturestat to inspect current multipliers.
+ * - Per-continent defaults (Vanilla/BC/WotLK) for outdoor creatures only,
+ *   optionally by creature level and by level difference to the player hit.
+ * - Optional per-zone, per-area, coordinate region and per-creature overrides
+ *   that trump continent values.
+ * - Optional population scaling from live per-zone player counts.
+ * - Optional scheduled profiles that swap in their own continent values and
+ *   overrides during configured windows of server time.
+ * - Optional check of the overrides against every world database spawn,
+ *   reporting those that match no spawn or bring one down to 1 HP.
+ * - Commands: .os mapstat / .os creaturestat to inspect current multipliers
+ *   and per-map totals of scaled creatures, .os dump to export the scaling
+ *   state of every loaded creature.
  */
 
 #include "Chat.h"
+#include "Common.h"
 #include "Config.h"
 #include "Creature.h"
+#include "DBCStores.h"
 #include "DataMap.h"
+#include "DatabaseEnv.h"
+#include "GameTime.h"
+#include "GridDefines.h"
+#include "Log.h"
 #include "Map.h"
+#include "MapMgr.h"
+#include "Player.h"
 #include "ScriptMgr.h"
+#include "Timer.h"
+#include "TypeContainerVisitor.h"
 #include "Unit.h"
 #include "World.h"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <future>
 #include <limits>
-#include <sstream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 using namespace Acore::ChatCommands;
 
 namespace
 {
-    struct OutdoorScalingInfo : public DataMap::Base
+    constexpr uint8 MAX_OUTDOOR_EXPANSIONS = 3;
+    // Matches CreatureEliteType: normal, elite, rare elite, world boss, rare.
+    constexpr uint8 MAX_OUTDOOR_RANKS = 5;
+    // Level tables cover creature levels 0..MAX_SCALING_LEVEL and level
+    // differences within +-MAX_SCALING_LEVEL; anything beyond uses the edge.
+    constexpr uint8 MAX_SCALING_LEVEL = 100;
+    constexpr int32 LEVEL_DELTA_OFFSET = MAX_SCALING_LEVEL;
+
+    enum ScalingStat : uint8
+    {
+        SCALING_STAT_HEALTH,
+        SCALING_STAT_DAMAGE,
+        SCALING_STAT_SPELL_DAMAGE,
+        MAX_SCALING_STATS
+    };
+
+    // Combined factors (module multiplier / world rate) indexed by stat.
+    using ScalingFactors = std::array<float, MAX_SCALING_STATS>;
+
+    // Per-creature scaling state, kept in its map's CreatureScalingTable.
+    struct OutdoorScalingInfo
     {
+        // Config generation this info was resolved against; 0 = never resolved.
+        uint32 generation = 0;
+        // Config generation the applied factors below were resolved against.
+        uint32 appliedGeneration = 0;
+        // Area at resolve time; the zone follows from it.
+        uint32 areaId = 0;
         float healthMult = 1.0f;
         float damageMult = 1.0f;
-        uint32 zoneId = 0;
-        uint8 expansion = 0;
-        enum class Source
+        // damageMult with the world spell damage rate already divided out,
+        // so the per-hit path is a single multiply.
+        float spellDamageFactor = 1.0f;
+        // Factors actually baked into the creature's health and weapon damage,
+        // so a later re-application can scale relative to them.
+        float appliedHealthFactor = 1.0f;
+        float appliedDamageFactor = 1.0f;
+        // Max health the applied factor added (or removed, if negative).
+        int32 appliedHealthDelta = 0;
+        enum class Source : uint8
         {
             None,
             Continent,
+            LevelCurve,
             ZoneOverride,
+            AreaOverride,
+            RegionOverride,
             CreatureOverride,
             Disabled,
             NotOutdoor,
             PetOrGuardian
         } source = Source::None;
+        uint8 expansion : 2 = 0;
+        // Held by a creature in the world; see CreatureScalingTable.
+        uint8 inUse : 1 = 0;
+    };
+
+    constexpr uint8 MAX_SCALING_SOURCES = uint8(OutdoorScalingInfo::Source::PetOrGuardian) + 1;
+
+    // HP and damage multipliers of one override, packed so a lookup reads
+    // both from the same cache line.
+    struct OverrideMults
+    {
+        float health = 0.0f;
+        float damage = 0.0f;
+
+        bool operator==(OverrideMults const&) const = default;
+    };
+
+    // One parsed "Id HealthMult [DamageMult]" override. When an id appears
+    // more than once the last row wins.
+    struct OverrideRow
+    {
+        uint32 id = 0;
+        OverrideMults mults;
+
+        bool operator==(OverrideRow const&) const = default;
+    };
+
+    using OverrideRows = std::vector<OverrideRow>;
+
+    // Zone ids are small and dense, so zone overrides live in a flat array
+    // indexed by zone id. A zero health multiplier marks an empty slot.
+    // Zones are the top-level AreaTable entries, so area overrides use the
+    // same table.
+    class ZoneOverrideTable
+    {
+    public:
+        // Upper bound on the array size; 3.3.5 area ids stay well below this.
+        static constexpr uint32 MaxZoneId = 0xFFFF;
+
+        void Build(OverrideRows const& rows)
+        {
+            uint32 maxZoneId = 0;
+            for (OverrideRow const& row : rows)
+                if (row.id <= MaxZoneId && row.id > maxZoneId)
+                    maxZoneId = row.id;
+
+            _entries.assign(rows.empty() ? 0 : maxZoneId + 1, OverrideMults());
+            _count = 0;
+
+            for (OverrideRow const& row : rows)
+            {
+                if (row.id > MaxZoneId)
+                {
+                    LOG_ERROR("module", "OutdoorScaling: zone/area override {} ignored, ids above {} are not supported.", row.id, MaxZoneId);
+                    continue;
+                }
+
+                if (_entries[row.id].health <= 0.0f)
+                    ++_count;
+
+                _entries[row.id] = row.mults;
+            }
+        }
+
+        OverrideMults const* Find(uint32 zoneId) const
+        {
+            if (zoneId >= _entries.size() || _entries[zoneId].health <= 0.0f)
+                return nullptr;
+
+            return &_entries[zoneId];
+        }
+
+        std::size_t Size() const { return _count; }
+
+        // One past the highest zone id that can hold an override.
+        uint32 Bound() const { return uint32(_entries.size()); }
+
+    private:
+        std::vector<OverrideMults> _entries;
+        std::size_t _count = 0;
+    };
+
+    // Open-addressing hash table for creature entry overrides. Slots hold the
+    // key next to its multipliers, so a hit costs one probe into one cache
+    // line; the table is kept at most half full to keep probe runs short.
+    // Entry 0 is not a valid creature and marks an empty slot.
+    class CreatureOverrideTable
+    {
+    public:
+        void Build(OverrideRows const& rows)
+        {
+            _slots.clear();
+            _count = 0;
+
+            if (rows.empty())
+                return;
+
+            uint32 bits = 4;
+            while ((std::size_t(1) << bits) < rows.size() * 2)
+                ++bits;
+
+            _shift = 32 - bits;
+            _mask = (uint32(1) << bits) - 1;
+            _slots.assign(std::size_t(1) << bits, Slot());
+
+            for (OverrideRow const& row : rows)
+            {
+                if (!row.id)
+                    continue;
+
+                uint32 index = Hash(row.id);
+                while (_slots[index].entry && _slots[index].entry != row.id)
+                    index = (index + 1) & _mask;
+
+                if (!_slots[index].entry)
+                    ++_count;
+
+                _slots[index] = { row.id, row.mults };
+            }
+        }
+
+        OverrideMults const* Find(uint32 entry) const
+        {
+            if (_slots.empty() || !entry)
+                return nullptr;
+
+            for (uint32 index = Hash(entry); ; index = (index + 1) & _mask)
+            {
+                Slot const& slot = _slots[index];
+                if (slot.entry == entry)
+                    return &slot.mults;
+
+                if (!slot.entry)
+                    return nullptr;
+            }
+        }
+
+        std::size_t Size() const { return _count; }
+
+        template<class Visitor>
+        void ForEach(Visitor&& visitor) const
+        {
+            for (Slot const& slot : _slots)
+                if (slot.entry)
+                    visitor(slot.entry, slot.mults);
+        }
+
+    private:
+        struct Slot
+        {
+            uint32 entry = 0;
+            OverrideMults mults;
+        };
+
+        // Fibonacci hashing; creature entries are often clustered, so the
+        // multiply spreads neighbouring ids across the table.
+        uint32 Hash(uint32 entry) const
+        {
+            return (entry * 2654435769u) >> _shift;
+        }
+
+        std::vector<Slot> _slots;
+        uint32 _shift = 32;
+        uint32 _mask = 0;
+        std::size_t _count = 0;
+    };
+
+    enum class RegionShape : uint8
+    {
+        Circle,
+        Rect
+    };
+
+    // One parsed "MapId circle X Y Radius HealthMult [DamageMult]" or
+    // "MapId rect MinX MinY MaxX MaxY HealthMult [DamageMult]" override.
+    struct RegionRow
+    {
+        uint32 mapId = 0;
+        RegionShape shape = RegionShape::Circle;
+        // Circle: centre x, centre y, radius. Rect: min x, min y, max x, max y.
+        std::array<float, 4> coords{};
+        OverrideMults mults;
+
+        bool operator==(RegionRow const&) const = default;
+    };
+
+    using RegionRows = std::vector<RegionRow>;
+
+    // Circle and rectangle overrides bucketed per map by the core's 533 yard
+    // map grids, so a lookup only tests the few regions touching the grid the
+    // position falls in. Where regions overlap, the later row wins.
+    class RegionOverrideIndex
+    {
+    public:
+        void Build(RegionRows const& rows)
+        {
+            _regions.clear();
+            _maps.clear();
+
+            _regions.reserve(rows.size());
+            for (RegionRow const& row : rows)
+                _regions.push_back(MakeRegion(row));
+
+            std::vector<uint32> mapIds;
+            for (RegionRow const& row : rows)
+                mapIds.push_back(row.mapId);
+
+            std::sort(mapIds.begin(), mapIds.end());
+            mapIds.erase(std::unique(mapIds.begin(), mapIds.end()), mapIds.end());
+
+            for (uint32 mapId : mapIds)
+            {
+                MapRegions& map = _maps.emplace_back();
+                map.mapId = mapId;
+                map.cellStart.assign(CellCount + 1, 0);
+
+                // Counting sort into per-cell lists: count, prefix sum, fill.
+                ForEachCell(rows, mapId, [&](uint32 /*region*/, uint32 cell) { ++map.cellStart[cell + 1]; });
+
+                for (uint32 cell = 0; cell < CellCount; ++cell)
+                    map.cellStart[cell + 1] += map.cellStart[cell];
+
+                std::vector<uint32> fill(map.cellStart.begin(), map.cellStart.end() - 1);
+                map.cellRegions.resize(map.cellStart.back());
+                ForEachCell(rows, mapId, [&](uint32 region, uint32 cell) { map.cellRegions[fill[cell]++] = region; });
+            }
+        }
+
+        OverrideMults const* Find(uint32 mapId, float x, float y) const
+        {
+            std::size_t region = FindIndex(mapId, x, y);
+            return region < _regions.size() ? &_regions[region].mults : nullptr;
+        }
+
+        // Row of the region Find() picks, or Size() if none contains the position.
+        std::size_t FindIndex(uint32 mapId, float x, float y) const
+        {
+            auto itr = std::lower_bound(_maps.begin(), _maps.end(), mapId, [](MapRegions const& map, uint32 id)
+            {
+                return map.mapId < id;
+            });
+
+            if (itr == _maps.end() || itr->mapId != mapId)
+                return _regions.size();
+
+            uint32 cell = CellIndex(CellCoord(x), CellCoord(y));
+            for (uint32 index = itr->cellStart[cell]; index < itr->cellStart[cell + 1]; ++index)
+            {
+                uint32 region = itr->cellRegions[index];
+                if (_regions[region].Contains(x, y))
+                    return region;
+            }
+
+            return _regions.size();
+        }
+
+        std::size_t Size() const { return _regions.size(); }
+
+    private:
+        static constexpr uint32 CellCount = MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS;
+
+        struct Region
+        {
+            // Bounding box; for rectangles it is the whole shape.
+            float minX = 0.0f;
+            float minY = 0.0f;
+            float maxX = 0.0f;
+            float maxY = 0.0f;
+            float centerX = 0.0f;
+            float centerY = 0.0f;
+            float radiusSq = 0.0f;
+            bool circle = false;
+            OverrideMults mults;
+
+            bool Contains(float x, float y) const
+            {
+                if (x < minX || x > maxX || y < minY || y > maxY)
+                    return false;
+
+                if (!circle)
+                    return true;
+
+                float dx = x - centerX;
+                float dy = y - centerY;
+                return dx * dx + dy * dy <= radiusSq;
+            }
+        };
+
+        struct MapRegions
+        {
+            uint32 mapId = 0;
+            // Regions touching cell c are cellRegions[cellStart[c], cellStart[c + 1]).
+            std::vector<uint32> cellStart;
+            std::vector<uint32> cellRegions;
+        };
+
+        static Region MakeRegion(RegionRow const& row)
+        {
+            Region region;
+            region.mults = row.mults;
+            region.circle = row.shape == RegionShape::Circle;
+
+            if (region.circle)
+            {
+                float radius = row.coords[2];
+                region.centerX = row.coords[0];
+                region.centerY = row.coords[1];
+                region.radiusSq = radius * radius;
+                region.minX = region.centerX - radius;
+                region.minY = region.centerY - radius;
+                region.maxX = region.centerX + radius;
+                region.maxY = region.centerY + radius;
+            }
+            else
+            {
+                region.minX = row.coords[0];
+                region.minY = row.coords[1];
+                region.maxX = row.coords[2];
+                region.maxY = row.coords[3];
+            }
+
+            return region;
+        }
+
+        static uint32 CellCoord(float coord)
+        {
+            float cell = std::floor(coord / SIZE_OF_GRIDS) + float(CENTER_GRID_ID);
+            return uint32(std::clamp(cell, 0.0f, float(MAX_NUMBER_OF_GRIDS - 1)));
+        }
+
+        static uint32 CellIndex(uint32 cellX, uint32 cellY)
+        {
+            return cellY * MAX_NUMBER_OF_GRIDS + cellX;
+        }
+
+        // Visits every (region, cell) pair of the map's regions, later rows
+        // first so that they win when regions overlap.
+        template<class Visitor>
+        void ForEachCell(RegionRows const& rows, uint32 mapId, Visitor&& visitor) const
+        {
+            for (uint32 region = uint32(rows.size()); region-- > 0;)
+            {
+                if (rows[region].mapId != mapId)
+                    continue;
+
+                Region const& bounds = _regions[region];
+                for (uint32 cellY = CellCoord(bounds.minY); cellY <= CellCoord(bounds.maxY); ++cellY)
+                    for (uint32 cellX = CellCoord(bounds.minX); cellX <= CellCoord(bounds.maxX); ++cellX)
+                        visitor(region, CellIndex(cellX, cellY));
+            }
+        }
+
+        std::vector<Region> _regions;
+        // Sorted by map id; only maps that have regions.
+        std::vector<MapRegions> _maps;
+    };
+
+    // Which live creatures a reload can change. Built by diffing the new
+    // snapshot against the one it replaces.
+    struct ReapplyPlan
+    {
+        // Only set for reloads with OutdoorScaling.Reapply.Enable.
+        bool pending = false;
+        // Continent, rank, level curve, region, population or world rate
+        // values changed: every creature.
+        bool all = false;
+        // Sorted zone ids, area ids and creature entries whose override changed.
+        std::vector<uint32> zones;
+        std::vector<uint32> areas;
+        std::vector<uint32> entries;
+
+        bool Affects(uint32 zoneId, uint32 areaId, uint32 entry) const
+        {
+            return all ||
+                std::binary_search(zones.begin(), zones.end(), zoneId) ||
+                std::binary_search(areas.begin(), areas.end(), areaId) ||
+                std::binary_search(entries.begin(), entries.end(), entry);
+        }
+    };
+
+    // Override kinds as stored in the Type column of mod_outdoor_scaling_overrides.
+    enum OverrideKind : uint8
+    {
+        OVERRIDE_KIND_ZONE     = 0,
+        OVERRIDE_KIND_CREATURE = 1,
+        OVERRIDE_KIND_AREA     = 2,
+        MAX_OVERRIDE_KINDS,
+        // Not keyed by id alone: MapId and the bounds columns describe it.
+        OVERRIDE_KIND_REGION   = MAX_OVERRIDE_KINDS
+    };
+
+    // Override rows read from the world database, shared between snapshots
+    // until the next query replaces them.
+    struct DatabaseOverrides
+    {
+        std::array<OverrideRows, MAX_OVERRIDE_KINDS> rows;
+        // In Id order, so the highest Id wins where regions overlap.
+        RegionRows regions;
+    };
+
+    // One window of a scaling profile's schedule, in server local time.
+    struct ScheduleWindow
+    {
+        // Bit per weekday, tm_wday order (bit 0 = Sunday).
+        uint8 days = 0x7F;
+        // Minutes since midnight; a window ending before it starts runs past
+        // midnight into the next day.
+        uint16 start = 0;
+        uint16 end = 0;
+
+        bool Contains(uint8 weekday, uint16 minute) const
+        {
+            if (start < end)
+                return (days & (1 << weekday)) && minute >= start && minute < end;
+
+            uint8 previousDay = (weekday + 6) % 7;
+            return ((days & (1 << weekday)) && minute >= start) || ((days & (1 << previousDay)) && minute < end);
+        }
+    };
+
+    using ScheduleWindows = std::vector<ScheduleWindow>;
+
+    // Piecewise linear curve from "Key HealthMult [DamageMult]" points, e.g.
+    // player count -> multiplier for population scaling. Flat beyond the first
+    // and last point.
+    struct MultiplierCurve
+    {
+        // Sorted by key (OverrideRow::id).
+        OverrideRows points;
+
+        void Build(OverrideRows rows)
+        {
+            std::stable_sort(rows.begin(), rows.end(), [](OverrideRow const& a, OverrideRow const& b)
+            {
+                return a.id < b.id;
+            });
+
+            // Last row wins for a repeated player count, as for overrides.
+            points.clear();
+            for (OverrideRow const& row : rows)
+            {
+                if (!points.empty() && points.back().id == row.id)
+                    points.back() = row;
+                else
+                    points.push_back(row);
+            }
+        }
+
+        OverrideMults Evaluate(uint32 key) const
+        {
+            if (points.empty())
+                return { 1.0f, 1.0f };
+
+            if (key <= points.front().id)
+                return points.front().mults;
+
+            if (key >= points.back().id)
+                return points.back().mults;
+
+            auto upper = std::upper_bound(points.begin(), points.end(), key, [](uint32 value, OverrideRow const& point)
+            {
+                return value < point.id;
+            });
+            auto lower = upper - 1;
+
+            float t = float(key - lower->id) / float(upper->id - lower->id);
+            return {
+                lower->mults.health + (upper->mults.health - lower->mults.health) * t,
+                lower->mults.damage + (upper->mults.damage - lower->mults.damage) * t
+            };
+        }
+
+        bool operator==(MultiplierCurve const&) const = default;
     };
 
+    // Immutable once published. A reload builds a fresh snapshot and swaps it
+    // in, so readers on map update threads never see a half-written config.
     struct OutdoorScalingConfig
     {
+        // Unique per published snapshot; cached per-creature results compare against it.
+        uint32 generation = 0;
+        // Generation of the loaded snapshot, shared with its scheduled profiles.
+        uint32 baseGeneration = 0;
+        // Scheduled profiles (OutdoorScaling.Profiles): complete snapshots
+        // built at load from this one with their own continent values and
+        // overrides on top. Owned here, so they are retired together with it.
+        std::string profileName = "default";
+        ScheduleWindows schedule;
+        std::vector<std::shared_ptr<OutdoorScalingConfig>> profiles;
         bool enabled = true;
-        std::array<float, 3> continentHealth{ {1.0f, 1.0f, 1.0f} };
-        std::array<float, 3> continentDamage{ {1.0f, 1.0f, 1.0f} };
-        std::unordered_map<uint32, std::pair<float, float>> zoneOverrides;
-        std::unordered_map<uint32, std::pair<float, float>> creatureOverrides;
+        std::array<float, MAX_OUTDOOR_EXPANSIONS> continentHealth{ {1.0f, 1.0f, 1.0f} };
+        std::array<float, MAX_OUTDOOR_EXPANSIONS> continentDamage{ {1.0f, 1.0f, 1.0f} };
+        // Outdoor multipliers per creature rank, stacked on top of whichever
+        // continent/zone/creature value applies.
+        std::array<float, MAX_OUTDOOR_RANKS> rankHealth{ {1.0f, 1.0f, 1.0f, 1.0f, 1.0f} };
+        std::array<float, MAX_OUTDOOR_RANKS> rankDamage{ {1.0f, 1.0f, 1.0f, 1.0f, 1.0f} };
+        // 1 / Rate.Creature.* for each rank and stat, captured at load.
+        std::array<ScalingFactors, MAX_OUTDOOR_RANKS> worldRateInverse{};
+        // Final factors for continent defaults, so the common case needs no math.
+        std::array<std::array<ScalingFactors, MAX_OUTDOOR_RANKS>, MAX_OUTDOOR_EXPANSIONS> continentFactors{};
+        // Per-level multipliers replacing the continent default, compiled from
+        // OutdoorScaling.Level.<exp>.Curve so a resolve is a single index.
+        std::array<bool, MAX_OUTDOOR_EXPANSIONS> levelCurveEnabled{};
+        std::array<std::array<OverrideMults, MAX_SCALING_LEVEL + 1>, MAX_OUTDOOR_EXPANSIONS> levelCurve{};
+        // Damage multiplier by creature level minus player level, offset by
+        // LEVEL_DELTA_OFFSET, compiled from OutdoorScaling.LevelDelta.<exp>.Curve.
+        std::array<bool, MAX_OUTDOOR_EXPANSIONS> levelDeltaEnabled{};
+        bool anyLevelDelta = false;
+        std::array<std::array<float, 2 * LEVEL_DELTA_OFFSET + 1>, MAX_OUTDOOR_EXPANSIONS> levelDeltaDamage{};
+        ZoneOverrideTable zoneOverrides;
+        ZoneOverrideTable areaOverrides;
+        CreatureOverrideTable creatureOverrides;
+        RegionOverrideIndex regionOverrides;
+        // Rows the tables above were built from, kept so that a database load
+        // can rebuild them without re-reading the config and vice versa.
+        std::array<OverrideRows, MAX_OVERRIDE_KINDS> configRows;
+        RegionRows regionRows;
+        // Database regions followed by regionRows, as indexed by regionOverrides.
+        RegionRows mergedRegionRows;
+        std::shared_ptr<DatabaseOverrides const> database;
+        bool databaseEnabled = false;
+        // Budget for re-scaling live creatures after a reload, per map update.
+        bool reapplyEnabled = false;
+        uint32 reapplyMaxPerTick = 200;
+        uint32 reapplyMaxMicroseconds = 500;
+        ReapplyPlan reapply;
+        // Population scaling: the curve is fed the zone's effective player
+        // count, which only follows the live count once it moved by at least
+        // populationHysteresis players and populationMinChangeMs has passed.
+        bool populationEnabled = false;
+        MultiplierCurve populationCurve;
+        uint32 populationHysteresis = 3;
+        uint32 populationMinChangeMs = 120 * IN_MILLISECONDS;
+        // Check the overrides against the world database's spawns after each
+        // load and log the ones that look wrong.
+        bool validateEnabled = false;
+        bool perfEnabled = true;
+        // Time one in this many hook calls per thread; 0 only counts calls.
+        uint32 perfSampleRate = 64;
+        uint32 perfLogIntervalSeconds = 0;
+        // Where .os dump writes its files.
+        std::string dumpDirectory = "data";
     };
 
-    OutdoorScalingConfig gConfig;
+    // Everything ComputeScaling looks at, so that callers without a creature
+    // (.os mapstat, offline tools) ask exactly the question a spawn would.
+    struct ScalingQuery
+    {
+        Map* map = nullptr;
+        uint32 zoneId = 0;
+        uint32 areaId = 0;
+        float x = 0.0f;
+        float y = 0.0f;
+        uint32 entry = 0;
+        uint8 rank = 0;
+        uint8 level = 0;
+        bool isPetOrGuardian = false;
+    };
 
-    bool IsOutdoorContinent(Map const* map)
+    struct ScalingResult
     {
-        if (!map)
-            return false;
+        float healthMult = 1.0f;
+        float damageMult = 1.0f;
+        ScalingFactors factors{ {1.0f, 1.0f, 1.0f} };
+        OutdoorScalingInfo::Source source = OutdoorScalingInfo::Source::None;
+        uint32 zoneId = 0;
+        uint32 areaId = 0;
+        uint8 expansion = 0;
+    };
 
-        MapEntry const* entry = map->GetEntry();
-        if (!entry)
-            return false;
 
-        return !map->Instanceable() && entry->IsContinent();
+    // Totals over scaling records, for .os mapstat.
+    struct ScalingTotals
+    {
+        std::array<uint32, MAX_SCALING_SOURCES> sources{};
+        std::array<uint32, MAX_OUTDOOR_EXPANSIONS> expansions{};
+        // Over records whose stats are scaled only: the factors applied to
+        // them, summed in units of FixedOne, and the max health they added
+        // and removed. Maxima filled in by ScalingAggregates::Totals().
+        uint32 scaled = 0;
+        uint64 healthSum = 0;
+        uint64 damageSum = 0;
+        float healthMax = 0.0f;
+        float damageMax = 0.0f;
+        uint64 healthAdded = 0;
+        uint64 healthRemoved = 0;
+
+        // A record converts to the same fixed point value on removal as on
+        // addition, so a removal cancels its addition to the bit.
+        static constexpr double FixedOne = double(1 << 24);
+
+        uint32 Count() const
+        {
+            uint32 count = 0;
+            for (uint32 sourceCount : sources)
+                count += sourceCount;
+            return count;
+        }
+
+        float HealthMean() const { return scaled ? float(double(healthSum) / FixedOne / scaled) : 0.0f; }
+        float DamageMean() const { return scaled ? float(double(damageSum) / FixedOne / scaled) : 0.0f; }
+
+        ScalingTotals& operator+=(ScalingTotals const& other)
+        {
+            for (uint8 source = 0; source < MAX_SCALING_SOURCES; ++source)
+                sources[source] += other.sources[source];
+            for (uint8 expansion = 0; expansion < MAX_OUTDOOR_EXPANSIONS; ++expansion)
+                expansions[expansion] += other.expansions[expansion];
+
+            scaled += other.scaled;
+            healthSum += other.healthSum;
+            damageSum += other.damageSum;
+            healthMax = std::max(healthMax, other.healthMax);
+            damageMax = std::max(damageMax, other.damageMax);
+            healthAdded += other.healthAdded;
+            healthRemoved += other.healthRemoved;
+            return *this;
+        }
+    };
+
+    bool IsScaledSource(OutdoorScalingInfo::Source source)
+    {
+        return source == OutdoorScalingInfo::Source::Continent ||
+            source == OutdoorScalingInfo::Source::LevelCurve ||
+            source == OutdoorScalingInfo::Source::ZoneOverride ||
+            source == OutdoorScalingInfo::Source::AreaOverride ||
+            source == OutdoorScalingInfo::Source::RegionOverride ||
+            source == OutdoorScalingInfo::Source::CreatureOverride;
+    }
+
+    // A record whose creature's stats carry scaling: a scaled source, or
+    // factors still applied from an earlier resolve.
+    bool HasScaledStats(OutdoorScalingInfo const& info)
+    {
+        return IsScaledSource(info.source) || info.appliedHealthFactor != 1.0f || info.appliedDamageFactor != 1.0f;
     }
 
-    uint8 ClampExpansion(uint8 expansion)
+    // Number of records per distinct HP and damage factor pair, so that
+    // the maxima survive removals. Open addressing on the packed pair; pairs
+    // that drop to zero keep their slot, as the same few keep coming back on
+    // respawn.
+    class MultiplierCounts
+    {
+    public:
+        void Add(float health, float damage, int32 delta)
+        {
+            if (_slots.size() < (_used + 1) * 2)
+                Grow();
+
+            // Never 0: multipliers are validated positive.
+            uint64 key = (uint64(std::bit_cast<uint32>(health)) << 32) | std::bit_cast<uint32>(damage);
+            uint32 index = Hash(key);
+            while (_slots[index].key && _slots[index].key != key)
+                index = (index + 1) & _mask;
+
+            if (!_slots[index].key)
+            {
+                _slots[index].key = key;
+                ++_used;
+            }
+
+            _slots[index].count += delta;
+        }
+
+        // Walks every slot; only for reporting.
+        std::pair<float, float> Max() const
+        {
+            std::pair<float, float> max{ 0.0f, 0.0f };
+            for (Slot const& slot : _slots)
+            {
+                if (!slot.count)
+                    continue;
+
+                max.first = std::max(max.first, std::bit_cast<float>(uint32(slot.key >> 32)));
+                max.second = std::max(max.second, std::bit_cast<float>(uint32(slot.key)));
+            }
+
+            return max;
+        }
+
+    private:
+        struct Slot
+        {
+            uint64 key = 0;
+            uint32 count = 0;
+        };
+
+        uint32 Hash(uint64 key) const
+        {
+            return uint32((key * 0x9E3779B97F4A7C15ull) >> 32) >> _shift;
+        }
+
+        void Grow()
+        {
+            std::vector<Slot> slots = std::move(_slots);
+            uint32 bits = slots.empty() ? 4 : 33 - _shift;
+            _shift = 32 - bits;
+            _mask = (uint32(1) << bits) - 1;
+            _slots.assign(std::size_t(1) << bits, Slot());
+
+            for (Slot const& slot : slots)
+            {
+                if (!slot.key)
+                    continue;
+
+                uint32 index = Hash(slot.key);
+                while (_slots[index].key)
+                    index = (index + 1) & _mask;
+
+                _slots[index] = slot;
+            }
+        }
+
+        std::vector<Slot> _slots;
+        uint32 _shift = 32;
+        uint32 _mask = 0;
+        std::size_t _used = 0;
+    };
+
+    // Running totals over one map's resolved scaling records, kept in step
+    // with every resolve, re-scale and release so that reporting them never
+    // walks the map's creatures.
+    class ScalingAggregates
+    {
+    public:
+        void Add(OutdoorScalingInfo const& info) { Apply(info, 1); }
+        void Remove(OutdoorScalingInfo const& info) { Apply(info, -1); }
+
+        // Moves a changed record's share; most re-resolves change nothing.
+        void Replace(OutdoorScalingInfo const& previous, OutdoorScalingInfo const& current)
+        {
+            if (previous.source == current.source && previous.expansion == current.expansion &&
+                previous.appliedHealthFactor == current.appliedHealthFactor &&
+                previous.appliedDamageFactor == current.appliedDamageFactor &&
+                previous.appliedHealthDelta == current.appliedHealthDelta)
+                return;
+
+            Remove(previous);
+            Add(current);
+        }
+
+        ScalingTotals Totals() const
+        {
+            ScalingTotals totals = _totals;
+            std::tie(totals.healthMax, totals.damageMax) = _multipliers.Max();
+            return totals;
+        }
+
+    private:
+        void Apply(OutdoorScalingInfo const& info, int32 delta)
+        {
+            _totals.sources[uint8(info.source)] += delta;
+            _totals.expansions[info.expansion] += delta;
+
+            if (!HasScaledStats(info))
+                return;
+
+            _totals.scaled += delta;
+            _totals.healthSum += uint64(delta * ToFixed(info.appliedHealthFactor));
+            _totals.damageSum += uint64(delta * ToFixed(info.appliedDamageFactor));
+            _multipliers.Add(info.appliedHealthFactor, info.appliedDamageFactor, delta);
+
+            if (info.appliedHealthDelta > 0)
+                _totals.healthAdded += uint64(int64(delta) * info.appliedHealthDelta);
+            else
+                _totals.healthRemoved += uint64(int64(delta) * -int64(info.appliedHealthDelta));
+        }
+
+        static int64 ToFixed(float mult)
+        {
+            return int64(double(mult) * ScalingTotals::FixedOne);
+        }
+
+        ScalingTotals _totals;
+        MultiplierCounts _multipliers;
+    };
+
+    // Scaling records of one continent map's creatures, indexed by GUID
+    // counter. The core hands out creature counters per map and densely from
+    // 1, so records sit in fixed-size pages allocated on first use and freed
+    // once every creature on them has left the world. Only the map's update
+    // thread touches it; its records are counted in the map's
+    // ScalingAggregates.
+    class CreatureScalingTable
+    {
+    public:
+        explicit CreatureScalingTable(ScalingAggregates& aggregates) : _aggregates(aggregates) { }
+
+        ScalingAggregates& Aggregates() { return _aggregates; }
+
+        // The creature's record, or nullptr if it has none.
+        OutdoorScalingInfo* Find(ObjectGuid::LowType counter)
+        {
+            std::size_t index = counter >> PageBits;
+            if (index >= _pages.size() || !_pages[index])
+                return nullptr;
+
+            OutdoorScalingInfo& info = _pages[index]->infos[counter & PageMask];
+            return info.inUse ? &info : nullptr;
+        }
+
+        // The creature's record, created unresolved if it has none.
+        OutdoorScalingInfo& Acquire(ObjectGuid::LowType counter)
+        {
+            std::size_t index = counter >> PageBits;
+            if (index >= _pages.size())
+                _pages.resize(index + 1);
+
+            std::unique_ptr<Page>& page = _pages[index];
+            if (!page)
+                page = std::make_unique<Page>();
+
+            OutdoorScalingInfo& info = page->infos[counter & PageMask];
+            if (!info.inUse)
+            {
+                info = OutdoorScalingInfo();
+                info.inUse = 1;
+                ++page->used;
+            }
+
+            return info;
+        }
+
+        void Release(ObjectGuid::LowType counter)
+        {
+            std::size_t index = counter >> PageBits;
+            if (index >= _pages.size() || !_pages[index])
+                return;
+
+            std::unique_ptr<Page>& page = _pages[index];
+            OutdoorScalingInfo& info = page->infos[counter & PageMask];
+            if (!info.inUse)
+                return;
+
+            if (info.generation)
+                _aggregates.Remove(info);
+
+            info.inUse = 0;
+            if (!--page->used)
+                page.reset();
+        }
+
+    private:
+        static constexpr uint32 PageBits = 10;
+        static constexpr uint32 PageMask = (1 << PageBits) - 1;
+
+        struct Page
+        {
+            std::array<OutdoorScalingInfo, 1 << PageBits> infos;
+            uint32 used = 0;
+        };
+
+        std::vector<std::unique_ptr<Page>> _pages;
+        ScalingAggregates& _aggregates;
+    };
+
+    // Per-map re-application state; only touched from that map's update thread.
+    struct OutdoorScalingMapInfo : public DataMap::Base
+    {
+        uint32 generation = 0;
+        uint32 baseGeneration = 0;
+        // Profile switched to while re-application is enabled; creatures
+        // re-scale to it at their next update.
+        uint32 switchGeneration = 0;
+        uint32 populationEpoch = 0;
+        // Last .os dump this map contributed to.
+        uint32 dumpId = 0;
+        std::vector<ObjectGuid> pending;
+        std::size_t cursor = 0;
+        // Resolved records of both tables below, for .os mapstat.
+        ScalingAggregates aggregates;
+        // Creatures and vehicles count their GUIDs separately.
+        CreatureScalingTable creatureScaling{ aggregates };
+        CreatureScalingTable vehicleScaling{ aggregates };
+    };
+
+    // Re-application progress across all maps, for .os reapply. queued and
+    // done only ever grow, since maps of an earlier pass may still be
+    // draining when a new one starts; a pass counts from passStart, the done
+    // count when it began, and takes over whatever was still outstanding.
+    struct ReapplyProgress
+    {
+        std::atomic<uint32> generation{ 0 };
+        std::atomic<uint32> queued{ 0 };
+        std::atomic<uint32> done{ 0 };
+        std::atomic<uint32> passStart{ 0 };
+        std::atomic<uint32> activeMaps{ 0 };
+    };
+
+    ReapplyProgress gReapplyProgress;
+
+    // Which (map, zone) a player is counted in, so that every event can
+    // move exactly one count regardless of the order the core fires them in.
+    struct OutdoorScalingPlayerInfo : public DataMap::Base
+    {
+        uint32 mapId = 0;
+        uint32 zoneId = 0;
+        bool counted = false;
+    };
+
+    // Player counts per (map, zone), maintained incrementally from login,
+    // logout and zone change events on any map thread and read lock-free.
+    // Fixed capacity open addressing; slots are claimed with a CAS and never
+    // released, since the set of zones is small and bounded.
+    class ZonePopulation
+    {
+    public:
+        static constexpr uint32 Capacity = 4096;
+
+        // Returns false if the table is full.
+        bool Add(uint32 mapId, uint32 zoneId, int32 delta)
+        {
+            Slot* slot = Acquire(MakeKey(mapId, zoneId));
+            if (!slot)
+                return false;
+
+            slot->players.fetch_add(uint32(delta), std::memory_order_relaxed);
+            return true;
+        }
+
+        uint32 Players(uint32 mapId, uint32 zoneId) const
+        {
+            Slot const* slot = Find(MakeKey(mapId, zoneId));
+            return slot ? slot->players.load(std::memory_order_relaxed) : 0;
+        }
+
+        // The count the curve sees; lags Players() by the hysteresis and rate limit.
+        uint32 Effective(uint32 mapId, uint32 zoneId) const
+        {
+            Slot const* slot = Find(MakeKey(mapId, zoneId));
+            return slot ? slot->effective.load(std::memory_order_relaxed) : 0;
+        }
+
+        // Bumped whenever any effective count changes.
+        uint32 Epoch() const { return _epoch.load(std::memory_order_acquire); }
+
+        // World thread only. Moves effective counts to the live ones where the
+        // difference reaches the hysteresis and the zone's last change is at
+        // least minChangeMs old.
+        void Update(uint64 nowMs, uint32 hysteresis, uint64 minChangeMs)
+        {
+            uint32 epoch = _epoch.load(std::memory_order_relaxed) + 1;
+            bool changed = false;
+
+            for (Slot& slot : _slots)
+            {
+                if (!slot.key.load(std::memory_order_acquire))
+                    continue;
+
+                uint32 players = slot.players.load(std::memory_order_relaxed);
+                uint32 effective = slot.effective.load(std::memory_order_relaxed);
+                uint32 difference = players > effective ? players - effective : effective - players;
+                if (!difference || difference < hysteresis || (slot.lastChangeMs && nowMs - slot.lastChangeMs < minChangeMs))
+                    continue;
+
+                slot.effective.store(players, std::memory_order_relaxed);
+                slot.changedEpoch.store(epoch, std::memory_order_relaxed);
+                slot.lastChangeMs = nowMs;
+                changed = true;
+            }
+
+            if (changed)
+                _epoch.store(epoch, std::memory_order_release);
+        }
+
+        // Zones of the map whose effective count changed after the given epoch.
+        void CollectChangedZones(uint32 mapId, uint32 sinceEpoch, std::vector<uint32>& zones) const
+        {
+            for (Slot const& slot : _slots)
+            {
+                uint64 key = slot.key.load(std::memory_order_acquire);
+                if (key && uint32(key >> 32) == mapId + 1 && slot.changedEpoch.load(std::memory_order_relaxed) > sinceEpoch)
+                    zones.push_back(uint32(key));
+            }
+
+            std::sort(zones.begin(), zones.end());
+        }
+
+    private:
+        struct Slot
+        {
+            // (mapId + 1) << 32 | zoneId; 0 marks an empty slot.
+            std::atomic<uint64> key{ 0 };
+            std::atomic<uint32> players{ 0 };
+            std::atomic<uint32> effective{ 0 };
+            std::atomic<uint32> changedEpoch{ 0 };
+            // World thread only.
+            uint64 lastChangeMs = 0;
+        };
+
+        static uint64 MakeKey(uint32 mapId, uint32 zoneId)
+        {
+            return (uint64(mapId) + 1) << 32 | zoneId;
+        }
+
+        static uint32 Hash(uint64 key)
+        {
+            return uint32((key * 11400714819323198485ull) >> 52);
+        }
+
+        Slot const* Find(uint64 key) const
+        {
+            for (uint32 probe = 0, index = Hash(key); probe < Capacity; ++probe, index = (index + 1) & (Capacity - 1))
+            {
+                uint64 slotKey = _slots[index].key.load(std::memory_order_acquire);
+                if (slotKey == key)
+                    return &_slots[index];
+
+                if (!slotKey)
+                    return nullptr;
+            }
+
+            return nullptr;
+        }
+
+        Slot* Acquire(uint64 key)
+        {
+            for (uint32 probe = 0, index = Hash(key); probe < Capacity; ++probe, index = (index + 1) & (Capacity - 1))
+            {
+                uint64 slotKey = _slots[index].key.load(std::memory_order_acquire);
+                if (!slotKey && _slots[index].key.compare_exchange_strong(slotKey, key, std::memory_order_acq_rel))
+                    return &_slots[index];
+
+                // Either already ours, or another thread claimed it first.
+                if (slotKey == key)
+                    return &_slots[index];
+            }
+
+            return nullptr;
+        }
+
+        static_assert((Capacity & (Capacity - 1)) == 0 && Capacity == (1u << 12), "Hash() yields 12 bit indices");
+
+        std::array<Slot, Capacity> _slots;
+        std::atomic<uint32> _epoch{ 0 };
+    };
+
+    ZonePopulation gPopulation;
+
+    // Profile 0 is the loaded snapshot itself, 1..n its scheduled profiles.
+    OutdoorScalingConfig const& ProfileAt(OutdoorScalingConfig const& base, uint32 profile)
+    {
+        return profile && profile <= base.profiles.size() ? *base.profiles[profile - 1] : base;
+    }
+
+    OutdoorScalingConfig& ProfileAt(OutdoorScalingConfig& base, uint32 profile)
+    {
+        return profile && profile <= base.profiles.size() ? *base.profiles[profile - 1] : base;
+    }
+
+    // RCU-style holder for the active config snapshot. Readers do a single
+    // acquire load and never lock. Snapshots replaced by Publish() are retired
+    // and only freed by Reclaim() once a grace period of world ticks has
+    // passed; map updates are joined every world tick and never keep the
+    // snapshot beyond a single hook call, so nothing can still be reading it.
+    // Readers see the active profile of the loaded snapshot; switching
+    // profiles is a single pointer store.
+    class OutdoorScalingConfigStore
+    {
+    public:
+        OutdoorScalingConfigStore()
+        {
+            // Placeholder until the first config load; its factor tables are
+            // not built yet, so it must not scale anything.
+            auto placeholder = std::make_unique<OutdoorScalingConfig>();
+            placeholder->enabled = false;
+
+            _current.store(placeholder.get(), std::memory_order_relaxed);
+            _owned = std::move(placeholder);
+        }
+
+        OutdoorScalingConfig const& Get() const
+        {
+            return *_current.load(std::memory_order_acquire);
+        }
+
+        // World thread only. The reference stays valid until the next Reclaim().
+        OutdoorScalingConfig const& GetBase()
+        {
+            std::lock_guard<std::mutex> guard(_writerLock);
+            return *_owned;
+        }
+
+        uint32 ActiveProfile() const
+        {
+            return _activeProfile.load(std::memory_order_relaxed);
+        }
+
+        void Publish(std::unique_ptr<OutdoorScalingConfig> config, uint32 activeProfile)
+        {
+            std::lock_guard<std::mutex> guard(_writerLock);
+            _activeProfile.store(activeProfile, std::memory_order_relaxed);
+            PublishLocked(std::move(config));
+        }
+
+        // Publishes only if the live snapshot is still the given generation,
+        // so a background build never overwrites a newer config reload.
+        bool PublishIfCurrent(std::unique_ptr<OutdoorScalingConfig> config, uint32 expectedGeneration)
+        {
+            std::lock_guard<std::mutex> guard(_writerLock);
+            if (_owned->generation != expectedGeneration)
+                return false;
+
+            PublishLocked(std::move(config));
+            return true;
+        }
+
+        // Switches readers to another prebuilt profile of the live snapshot.
+        // Nothing is rebuilt: the profile has its own generation, so each
+        // creature re-resolves on its next lookup and, with re-application
+        // enabled, re-scales its stats at its next update. Returns false if
+        // the profile is already active.
+        bool Activate(uint32 profile)
+        {
+            std::lock_guard<std::mutex> guard(_writerLock);
+            if (profile > _owned->profiles.size())
+                profile = 0;
+
+            if (profile == _activeProfile.load(std::memory_order_relaxed))
+                return false;
+
+            _activeProfile.store(profile, std::memory_order_relaxed);
+            _current.store(&ProfileAt(*_owned, profile), std::memory_order_release);
+            return true;
+        }
+
+        // World thread only, once per world update.
+        void Reclaim()
+        {
+            std::lock_guard<std::mutex> guard(_writerLock);
+
+            ++_tick;
+            while (!_retired.empty() && _tick - _retired.front().second >= GracePeriodTicks)
+                _retired.erase(_retired.begin());
+        }
+
+    private:
+        void PublishLocked(std::unique_ptr<OutdoorScalingConfig> config)
+        {
+            config->generation = ++_lastGeneration;
+            config->baseGeneration = config->generation;
+            for (auto const& profile : config->profiles)
+            {
+                profile->generation = ++_lastGeneration;
+                profile->baseGeneration = config->generation;
+            }
+
+            if (_activeProfile.load(std::memory_order_relaxed) > config->profiles.size())
+                _activeProfile.store(0, std::memory_order_relaxed);
+
+            _current.store(&ProfileAt(*config, _activeProfile.load(std::memory_order_relaxed)), std::memory_order_release);
+
+            _retired.emplace_back(std::move(_owned), _tick);
+            _owned = std::move(config);
+        }
+
+        static constexpr uint32 GracePeriodTicks = 2;
+
+        std::atomic<OutdoorScalingConfig const*> _current{ nullptr };
+        // Written under _writerLock.
+        std::atomic<uint32> _activeProfile{ 0 };
+
+        // Everything below is writer-side and guarded by _writerLock.
+        std::mutex _writerLock;
+        std::unique_ptr<OutdoorScalingConfig const> _owned;
+        std::vector<std::pair<std::unique_ptr<OutdoorScalingConfig const>, uint32>> _retired;
+        uint32 _tick = 0;
+        uint32 _lastGeneration = 0;
+    };
+
+    OutdoorScalingConfigStore gConfigStore;
+
+    enum PerfHook : uint8
+    {
+        PERF_HOOK_SELECT_LEVEL,
+        PERF_HOOK_SPELL_DAMAGE,
+        PERF_HOOK_MELEE_DAMAGE,
+        PERF_HOOK_PERIODIC_DAMAGE,
+        PERF_HOOK_HEAL,
+        PERF_HOOK_CONFIG_LOAD,
+        MAX_PERF_HOOKS
+    };
+
+    // Bucket b holds samples in [2^b, 2^(b+1)) ns; the last one is open-ended.
+    constexpr uint8 PERF_HISTOGRAM_BUCKETS = 32;
+
+    // Plain copy of the counters, summed over all threads.
+    struct PerfSnapshot
+    {
+        struct Hook
+        {
+            uint64 calls = 0;
+            uint64 sampled = 0;
+            uint64 sampledNs = 0;
+            std::array<uint64, PERF_HISTOGRAM_BUCKETS> histogram{};
+        };
+
+        std::array<Hook, MAX_PERF_HOOKS> hooks{};
+        std::array<uint64, MAX_SCALING_SOURCES> sources{};
+
+        PerfSnapshot operator-(PerfSnapshot const& base) const
+        {
+            PerfSnapshot delta = *this;
+            for (uint8 hook = 0; hook < MAX_PERF_HOOKS; ++hook)
+            {
+                delta.hooks[hook].calls -= base.hooks[hook].calls;
+                delta.hooks[hook].sampled -= base.hooks[hook].sampled;
+                delta.hooks[hook].sampledNs -= base.hooks[hook].sampledNs;
+                for (uint8 bucket = 0; bucket < PERF_HISTOGRAM_BUCKETS; ++bucket)
+                    delta.hooks[hook].histogram[bucket] -= base.hooks[hook].histogram[bucket];
+            }
+
+            for (uint8 source = 0; source < MAX_SCALING_SOURCES; ++source)
+                delta.sources[source] -= base.sources[source];
+
+            return delta;
+        }
+    };
+
+    // Counters owned by one thread. Only the owner writes them, so updates are
+    // a relaxed load and store rather than a locked read-modify-write, and
+    // readers may see values a few calls behind. Aligned so that blocks of
+    // different map update threads never share a cache line.
+    struct alignas(64) PerfThreadCounters
+    {
+        struct Hook
+        {
+            std::atomic<uint64> calls{ 0 };
+            std::atomic<uint64> sampled{ 0 };
+            std::atomic<uint64> sampledNs{ 0 };
+            std::array<std::atomic<uint64>, PERF_HISTOGRAM_BUCKETS> histogram{};
+        };
+
+        std::array<Hook, MAX_PERF_HOOKS> hooks{};
+        std::array<std::atomic<uint64>, MAX_SCALING_SOURCES> sources{};
+        // Owner only.
+        uint32 sampleCountdown = 0;
+
+        static void Add(std::atomic<uint64>& counter, uint64 value)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+    };
+
+    // Hands each thread its own counter block on first use and sums them on
+    // read. The lock is only taken when a thread registers and by readers.
+    class PerfRegistry
+    {
+    public:
+        // When counting began, at module load; rates over the lifetime
+        // counters are taken against it.
+        std::chrono::steady_clock::time_point Started() const { return _started; }
+
+        PerfThreadCounters& Local()
+        {
+            thread_local PerfThreadCounters* counters = nullptr;
+            if (!counters)
+            {
+                std::lock_guard<std::mutex> guard(_lock);
+                _threads.push_back(std::make_unique<PerfThreadCounters>());
+                counters = _threads.back().get();
+            }
+
+            return *counters;
+        }
+
+        PerfSnapshot Aggregate()
+        {
+            PerfSnapshot total;
+
+            std::lock_guard<std::mutex> guard(_lock);
+            for (auto const& counters : _threads)
+            {
+                for (uint8 hook = 0; hook < MAX_PERF_HOOKS; ++hook)
+                {
+                    PerfThreadCounters::Hook const& from = counters->hooks[hook];
+                    PerfSnapshot::Hook& to = total.hooks[hook];
+                    to.calls += from.calls.load(std::memory_order_relaxed);
+                    to.sampled += from.sampled.load(std::memory_order_relaxed);
+                    to.sampledNs += from.sampledNs.load(std::memory_order_relaxed);
+                    for (uint8 bucket = 0; bucket < PERF_HISTOGRAM_BUCKETS; ++bucket)
+                        to.histogram[bucket] += from.histogram[bucket].load(std::memory_order_relaxed);
+                }
+
+                for (uint8 source = 0; source < MAX_SCALING_SOURCES; ++source)
+                    total.sources[source] += counters->sources[source].load(std::memory_order_relaxed);
+            }
+
+            return total;
+        }
+
+    private:
+        std::chrono::steady_clock::time_point const _started = std::chrono::steady_clock::now();
+        std::mutex _lock;
+        // Blocks outlive their threads so no counts are lost.
+        std::vector<std::unique_ptr<PerfThreadCounters>> _threads;
+    };
+
+    PerfRegistry gPerf;
+
+    // Counts a hook call and, for one in sampleRate calls, times it into the
+    // calling thread's histogram.
+    class PerfScope
+    {
+    public:
+        PerfScope(PerfHook hook, bool enabled, uint32 sampleRate) : _hook(hook)
+        {
+            if (!enabled)
+                return;
+
+            _counters = &gPerf.Local();
+            PerfThreadCounters::Add(_counters->hooks[hook].calls, 1);
+
+            if (sampleRate && ++_counters->sampleCountdown >= sampleRate)
+            {
+                _counters->sampleCountdown = 0;
+                _timed = true;
+                _start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~PerfScope()
+        {
+            if (!_timed)
+                return;
+
+            uint64 ns = uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count());
+
+            uint8 bucket = 0;
+            while (bucket + 1 < PERF_HISTOGRAM_BUCKETS && (ns >> (bucket + 1)))
+                ++bucket;
+
+            PerfThreadCounters::Hook& hook = _counters->hooks[_hook];
+            PerfThreadCounters::Add(hook.sampled, 1);
+            PerfThreadCounters::Add(hook.sampledNs, ns);
+            PerfThreadCounters::Add(hook.histogram[bucket], 1);
+        }
+
+        PerfScope(PerfScope const&) = delete;
+        PerfScope& operator=(PerfScope const&) = delete;
+
+    private:
+        PerfHook _hook;
+        PerfThreadCounters* _counters = nullptr;
+        bool _timed = false;
+        std::chrono::steady_clock::time_point _start;
+    };
+
+    void CountResolve(OutdoorScalingConfig const& config, OutdoorScalingInfo::Source source)
+    {
+        if (config.perfEnabled)
+            PerfThreadCounters::Add(gPerf.Local().sources[uint8(source)], 1);
+    }
+
+    // Estimated latency at the given percentile (0..1), interpolated inside
+    // the log2 bucket it falls in.
+    double PerfPercentileNs(PerfSnapshot::Hook const& hook, double percentile)
+    {
+        uint64 total = 0;
+        for (uint64 count : hook.histogram)
+            total += count;
+
+        if (!total)
+            return 0.0;
+
+        double target = percentile * double(total);
+        uint64 seen = 0;
+        for (uint8 bucket = 0; bucket < PERF_HISTOGRAM_BUCKETS; ++bucket)
+        {
+            uint64 count = hook.histogram[bucket];
+            if (!count || double(seen + count) < target)
+            {
+                seen += count;
+                continue;
+            }
+
+            double low = bucket ? double(uint64(1) << bucket) : 0.0;
+            double high = double(uint64(1) << (bucket + 1));
+            return low + (high - low) * (target - double(seen)) / double(count);
+        }
+
+        return double(uint64(1) << PERF_HISTOGRAM_BUCKETS);
+    }
+
+    // Splits nanoseconds into a value and unit for display.
+    std::pair<double, char const*> FormatNs(double ns)
+    {
+        if (ns >= 1000000.0)
+            return { ns / 1000000.0, "ms" };
+        if (ns >= 1000.0)
+            return { ns / 1000.0, "us" };
+        return { ns, "ns" };
+    }
+
+    bool IsOutdoorContinent(Map const* map)
+    {
+        if (!map)
+            return false;
+
+        MapEntry const* entry = map->GetEntry();
+        if (!entry)
+            return false;
+
+        return !map->Instanceable() && entry->IsContinent();
+    }
+
+    uint8 ClampExpansion(uint8 expansion)
+    {
+        return expansion >= MAX_OUTDOOR_EXPANSIONS ? MAX_OUTDOOR_EXPANSIONS - 1 : expansion;
+    }
+
+    // Unknown ranks fall back to elite, as the world rate lookup always has.
+    uint8 ClampRank(uint32 rank)
+    {
+        return rank >= MAX_OUTDOOR_RANKS ? uint8(CREATURE_ELITE_ELITE) : uint8(rank);
+    }
+
+    float GetWorldRate(uint8 rank, ScalingStat stat)
+    {
+        static constexpr Rates rates[MAX_OUTDOOR_RANKS][MAX_SCALING_STATS] =
+        {
+            { RATE_CREATURE_NORMAL_HP,             RATE_CREATURE_NORMAL_DAMAGE,             RATE_CREATURE_NORMAL_SPELLDAMAGE },
+            { RATE_CREATURE_ELITE_ELITE_HP,        RATE_CREATURE_ELITE_ELITE_DAMAGE,        RATE_CREATURE_ELITE_ELITE_SPELLDAMAGE },
+            { RATE_CREATURE_ELITE_RAREELITE_HP,    RATE_CREATURE_ELITE_RAREELITE_DAMAGE,    RATE_CREATURE_ELITE_RAREELITE_SPELLDAMAGE },
+            { RATE_CREATURE_ELITE_WORLDBOSS_HP,    RATE_CREATURE_ELITE_WORLDBOSS_DAMAGE,    RATE_CREATURE_ELITE_WORLDBOSS_SPELLDAMAGE },
+            { RATE_CREATURE_ELITE_RARE_HP,         RATE_CREATURE_ELITE_RARE_DAMAGE,         RATE_CREATURE_ELITE_RARE_SPELLDAMAGE }
+        };
+
+        float rate = sWorld->getRate(rates[rank][stat]);
+        return rate > 0.0f ? rate : 1.0f;
+    }
+
+    // A multiplier of exactly 1 leaves the stat (and its world rate) untouched;
+    // anything else replaces the world rate with the module multiplier.
+    float ToFactor(float mult, float worldRateInverse)
+    {
+        if (std::abs(mult - 1.0f) < std::numeric_limits<float>::epsilon())
+            return 1.0f;
+
+        return mult * worldRateInverse;
+    }
+
+    ScalingFactors ToFactors(OutdoorScalingConfig const& config, uint8 rank, float healthMult, float damageMult)
+    {
+        ScalingFactors const& inverse = config.worldRateInverse[rank];
+        return { {
+            ToFactor(healthMult, inverse[SCALING_STAT_HEALTH]),
+            ToFactor(damageMult, inverse[SCALING_STAT_DAMAGE]),
+            ToFactor(damageMult, inverse[SCALING_STAT_SPELL_DAMAGE])
+        } };
+    }
+
+    // Fills the rank and continent factor tables; call once the world rates are loaded.
+    void BuildFactorTables(OutdoorScalingConfig& config)
+    {
+        for (uint8 rank = 0; rank < MAX_OUTDOOR_RANKS; ++rank)
+            for (uint8 stat = 0; stat < MAX_SCALING_STATS; ++stat)
+                config.worldRateInverse[rank][stat] = 1.0f / GetWorldRate(rank, ScalingStat(stat));
+
+        for (uint8 expansion = 0; expansion < MAX_OUTDOOR_EXPANSIONS; ++expansion)
+            for (uint8 rank = 0; rank < MAX_OUTDOOR_RANKS; ++rank)
+                config.continentFactors[expansion][rank] = ToFactors(config, rank,
+                    config.continentHealth[expansion] * config.rankHealth[rank],
+                    config.continentDamage[expansion] * config.rankDamage[rank]);
+    }
+
+    bool SameOverride(OverrideMults const* a, OverrideMults const* b)
+    {
+        if (!a || !b)
+            return a == b;
+
+        return a->health == b->health && a->damage == b->damage;
+    }
+
+    // Appends the ids whose override differs between the two tables, in order.
+    void DiffZoneOverrides(ZoneOverrideTable const& previous, ZoneOverrideTable const& next, std::vector<uint32>& changed)
+    {
+        uint32 bound = std::max(previous.Bound(), next.Bound());
+        for (uint32 id = 0; id < bound; ++id)
+            if (!SameOverride(previous.Find(id), next.Find(id)))
+                changed.push_back(id);
+    }
+
+    // Diffs the next snapshot against the live one so that re-application
+    // only revisits creatures whose scaling can have changed.
+    void BuildReapplyPlan(OutdoorScalingConfig const& previous, OutdoorScalingConfig& next)
+    {
+        ReapplyPlan& plan = next.reapply;
+        plan.pending = true;
+        // Creatures are not bucketed by position or player count, so any
+        // region or population curve change revisits everything.
+        plan.all = previous.enabled != next.enabled ||
+            previous.rankHealth != next.rankHealth ||
+            previous.rankDamage != next.rankDamage ||
+            previous.worldRateInverse != next.worldRateInverse ||
+            previous.continentFactors != next.continentFactors ||
+            previous.levelCurveEnabled != next.levelCurveEnabled ||
+            previous.levelCurve != next.levelCurve ||
+            previous.mergedRegionRows != next.mergedRegionRows ||
+            previous.populationEnabled != next.populationEnabled ||
+            (next.populationEnabled && previous.populationCurve != next.populationCurve);
+
+        if (plan.all)
+            return;
+
+        DiffZoneOverrides(previous.zoneOverrides, next.zoneOverrides, plan.zones);
+        DiffZoneOverrides(previous.areaOverrides, next.areaOverrides, plan.areas);
+
+        previous.creatureOverrides.ForEach([&](uint32 entry, OverrideMults const& mults)
+        {
+            if (!SameOverride(&mults, next.creatureOverrides.Find(entry)))
+                plan.entries.push_back(entry);
+        });
+
+        next.creatureOverrides.ForEach([&](uint32 entry, OverrideMults const& /*mults*/)
+        {
+            if (!previous.creatureOverrides.Find(entry))
+                plan.entries.push_back(entry);
+        });
+
+        std::sort(plan.entries.begin(), plan.entries.end());
+    }
+
+    enum class OverrideRowError
+    {
+        None,
+        Empty,
+        BadId,
+        MissingHealth,
+        BadHealth,
+        BadDamage,
+        NotPositive,
+        TrailingText,
+        BadShape,
+        BadCoordinate,
+        BadExtent,
+        BadDays,
+        BadTime
+    };
+
+    char const* OverrideRowErrorToString(OverrideRowError error)
+    {
+        switch (error)
+        {
+            case OverrideRowError::Empty:         return "empty entry";
+            case OverrideRowError::BadId:         return "id is not an unsigned integer";
+            case OverrideRowError::MissingHealth: return "missing health multiplier";
+            case OverrideRowError::BadHealth:     return "health multiplier is not a number";
+            case OverrideRowError::BadDamage:     return "damage multiplier is not a number";
+            case OverrideRowError::NotPositive:   return "multipliers must be > 0";
+            case OverrideRowError::TrailingText:  return "unexpected text after damage multiplier";
+            case OverrideRowError::BadShape:      return "shape must be 'circle' or 'rect'";
+            case OverrideRowError::BadCoordinate: return "coordinate or radius is not a number";
+            case OverrideRowError::BadExtent:     return "radius must be > 0 and rect min <= max";
+            case OverrideRowError::BadDays:       return "days must be '*', a weekday (Mon..Sun) or a range such as Fri-Sun";
+            case OverrideRowError::BadTime:       return "time must be HH:MM-HH:MM with distinct start and end";
+            default:                              return "ok";
+        }
+    }
+
+    bool IsRowSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    // Splits off the next whitespace separated token; empty at end of input.
+    std::string_view NextToken(std::string_view& input)
+    {
+        std::size_t begin = 0;
+        while (begin < input.size() && IsRowSpace(input[begin]))
+            ++begin;
+
+        std::size_t end = begin;
+        while (end < input.size() && !IsRowSpace(input[end]))
+            ++end;
+
+        std::string_view token = input.substr(begin, end - begin);
+        input.remove_prefix(end);
+        return token;
+    }
+
+    template<class T>
+    bool ParseNumber(std::string_view token, T& value)
+    {
+        auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+        return ec == std::errc() && ptr == token.data() + token.size();
+    }
+
+    // Parses the "HealthMult [DamageMult]" tail of a row; an omitted
+    // DamageMult reuses HealthMult.
+    OverrideRowError ParseOverrideMults(std::string_view input, OverrideMults& mults)
+    {
+        std::string_view healthToken = NextToken(input);
+        std::string_view damageToken = NextToken(input);
+
+        if (healthToken.empty())
+            return OverrideRowError::MissingHealth;
+
+        if (!ParseNumber(healthToken, mults.health))
+            return OverrideRowError::BadHealth;
+
+        mults.damage = mults.health;
+        if (!damageToken.empty() && !ParseNumber(damageToken, mults.damage))
+            return OverrideRowError::BadDamage;
+
+        if (!NextToken(input).empty())
+            return OverrideRowError::TrailingText;
+
+        if (mults.health <= 0.0f || mults.damage <= 0.0f)
+            return OverrideRowError::NotPositive;
+
+        return OverrideRowError::None;
+    }
+
+    // Parses "Id HealthMult [DamageMult]".
+    OverrideRowError ParseOverrideRow(std::string_view input, OverrideRow& row)
+    {
+        std::string_view idToken = NextToken(input);
+        if (idToken.empty())
+            return OverrideRowError::Empty;
+
+        if (!ParseNumber(idToken, row.id))
+            return OverrideRowError::BadId;
+
+        return ParseOverrideMults(input, row.mults);
+    }
+
+    // Parses "MapId circle X Y Radius HealthMult [DamageMult]" or
+    // "MapId rect MinX MinY MaxX MaxY HealthMult [DamageMult]".
+    OverrideRowError ParseOverrideRow(std::string_view input, RegionRow& row)
+    {
+        std::string_view mapToken = NextToken(input);
+        if (mapToken.empty())
+            return OverrideRowError::Empty;
+
+        if (!ParseNumber(mapToken, row.mapId))
+            return OverrideRowError::BadId;
+
+        std::string_view shapeToken = NextToken(input);
+        if (shapeToken == "circle")
+            row.shape = RegionShape::Circle;
+        else if (shapeToken == "rect")
+            row.shape = RegionShape::Rect;
+        else
+            return OverrideRowError::BadShape;
+
+        std::size_t coordCount = row.shape == RegionShape::Circle ? 3 : 4;
+        for (std::size_t i = 0; i < coordCount; ++i)
+            if (!ParseNumber(NextToken(input), row.coords[i]))
+                return OverrideRowError::BadCoordinate;
+
+        bool validExtent = row.shape == RegionShape::Circle ?
+            row.coords[2] > 0.0f :
+            row.coords[0] <= row.coords[2] && row.coords[1] <= row.coords[3];
+        if (!validExtent)
+            return OverrideRowError::BadExtent;
+
+        return ParseOverrideMults(input, row.mults);
+    }
+
+    // One "Delta DamageMult" point of a level delta curve; Delta is the
+    // creature's level minus the player's and may be negative.
+    struct LevelDeltaRow
+    {
+        int32 delta = 0;
+        float damage = 1.0f;
+    };
+
+    using LevelDeltaRows = std::vector<LevelDeltaRow>;
+
+    OverrideRowError ParseOverrideRow(std::string_view input, LevelDeltaRow& row)
+    {
+        std::string_view deltaToken = NextToken(input);
+        if (deltaToken.empty())
+            return OverrideRowError::Empty;
+
+        if (!ParseNumber(deltaToken, row.delta))
+            return OverrideRowError::BadId;
+
+        std::string_view damageToken = NextToken(input);
+        if (damageToken.empty())
+            return OverrideRowError::MissingHealth;
+
+        if (!ParseNumber(damageToken, row.damage))
+            return OverrideRowError::BadDamage;
+
+        if (!NextToken(input).empty())
+            return OverrideRowError::TrailingText;
+
+        if (row.damage <= 0.0f)
+            return OverrideRowError::NotPositive;
+
+        return OverrideRowError::None;
+    }
+
+    // Parses a weekday name into its tm_wday index.
+    bool ParseWeekday(std::string_view token, uint8& weekday)
+    {
+        static constexpr std::array<std::string_view, 7> names = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+        for (uint8 day = 0; day < names.size(); ++day)
+        {
+            if (token == names[day])
+            {
+                weekday = day;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Parses "HH:MM" into minutes since midnight; 24:00 is allowed.
+    bool ParseTimeOfDay(std::string_view token, uint16& minutes)
+    {
+        std::size_t colon = token.find(':');
+        uint32 hours = 0;
+        uint32 mins = 0;
+        if (colon == std::string_view::npos || !ParseNumber(token.substr(0, colon), hours) || !ParseNumber(token.substr(colon + 1), mins))
+            return false;
+
+        if (mins >= 60 || hours * 60 + mins > 24 * 60)
+            return false;
+
+        minutes = uint16(hours * 60 + mins);
+        return true;
+    }
+
+    // Parses "[Days] HH:MM-HH:MM", Days being '*' (the default), a weekday
+    // such as Sat or a range such as Fri-Sun.
+    OverrideRowError ParseOverrideRow(std::string_view input, ScheduleWindow& row)
+    {
+        std::string_view token = NextToken(input);
+        if (token.empty())
+            return OverrideRowError::Empty;
+
+        if (token.find(':') == std::string_view::npos)
+        {
+            if (token != "*")
+            {
+                std::size_t dash = token.find('-');
+                uint8 first = 0;
+                uint8 last = 0;
+                if (!ParseWeekday(token.substr(0, dash), first))
+                    return OverrideRowError::BadDays;
+
+                last = first;
+                if (dash != std::string_view::npos && !ParseWeekday(token.substr(dash + 1), last))
+                    return OverrideRowError::BadDays;
+
+                row.days = 0;
+                for (uint8 day = first; ; day = (day + 1) % 7)
+                {
+                    row.days |= uint8(1 << day);
+                    if (day == last)
+                        break;
+                }
+            }
+
+            token = NextToken(input);
+        }
+
+        std::size_t dash = token.find('-');
+        if (dash == std::string_view::npos || !ParseTimeOfDay(token.substr(0, dash), row.start) ||
+            !ParseTimeOfDay(token.substr(dash + 1), row.end) || row.start == row.end || row.start == 24 * 60)
+            return OverrideRowError::BadTime;
+
+        if (!NextToken(input).empty())
+            return OverrideRowError::TrailingText;
+
+        return OverrideRowError::None;
+    }
+
+    // Rejected rows are logged individually up to this many per source.
+    constexpr uint32 MAX_REPORTED_ROW_ERRORS = 20;
+
+    // Appends the rows of a comma separated config value ("12 1.5, 85 0.8 0.9").
+    // Single pass over the string without allocating; only the output grows.
+    template<class Rows>
+    void ParseOverrideString(std::string_view input, std::string_view optionName, Rows& rows)
+    {
+        rows.reserve(rows.size() + std::size_t(std::count(input.begin(), input.end(), ',')) + 1);
+
+        uint32 index = 0;
+        uint32 rejected = 0;
+        while (!input.empty())
+        {
+            std::size_t comma = input.find(',');
+            std::string_view chunk = input.substr(0, comma);
+            input.remove_prefix(comma == std::string_view::npos ? input.size() : comma + 1);
+            ++index;
+
+            typename Rows::value_type row;
+            OverrideRowError error = ParseOverrideRow(chunk, row);
+            if (error == OverrideRowError::None)
+            {
+                rows.push_back(row);
+                continue;
+            }
+
+            // Trailing commas and blank entries are harmless.
+            if (error == OverrideRowError::Empty)
+                continue;
+
+            if (++rejected <= MAX_REPORTED_ROW_ERRORS)
+                LOG_ERROR("module", "OutdoorScaling: {} entry {} '{}' ignored: {}.", optionName, index, chunk, OverrideRowErrorToString(error));
+        }
+
+        if (rejected > MAX_REPORTED_ROW_ERRORS)
+            LOG_ERROR("module", "OutdoorScaling: {} had {} more rejected entries.", optionName, rejected - MAX_REPORTED_ROW_ERRORS);
+    }
+
+    // Appends rows from an override file: one row per line in the same format
+    // as the config value, '#' starts a comment. The file is streamed line by
+    // line into a reused buffer, so tables with tens of thousands of rows load
+    // without holding the whole file in memory.
+    template<class Rows>
+    bool LoadOverrideFile(std::string const& path, Rows& rows)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            LOG_ERROR("module", "OutdoorScaling: could not open override file '{}'.", path);
+            return false;
+        }
+
+        std::string line;
+        uint32 lineNumber = 0;
+        uint32 loaded = 0;
+        uint32 rejected = 0;
+        while (std::getline(file, line))
+        {
+            ++lineNumber;
+
+            std::string_view content(line);
+            content = content.substr(0, content.find('#'));
+
+            typename Rows::value_type row;
+            OverrideRowError error = ParseOverrideRow(content, row);
+            if (error == OverrideRowError::None)
+            {
+                rows.push_back(row);
+                ++loaded;
+                continue;
+            }
+
+            if (error == OverrideRowError::Empty)
+                continue;
+
+            if (++rejected <= MAX_REPORTED_ROW_ERRORS)
+                LOG_ERROR("module", "OutdoorScaling: {}:{}: row '{}' ignored: {}.", path, lineNumber, content, OverrideRowErrorToString(error));
+        }
+
+        if (rejected > MAX_REPORTED_ROW_ERRORS)
+            LOG_ERROR("module", "OutdoorScaling: {} had {} more rejected rows.", path, rejected - MAX_REPORTED_ROW_ERRORS);
+
+        LOG_INFO("module", "OutdoorScaling: loaded {} override rows from '{}' ({} rejected).", loaded, path, rejected);
+        return true;
+    }
+
+    // File rows first, then the inline config value, so inline entries win.
+    template<class Rows>
+    Rows LoadConfigOverrides(std::string const& optionName)
+    {
+        Rows rows;
+
+        std::string path = sConfigMgr->GetOption<std::string>(optionName + ".File", "", false);
+        if (!path.empty())
+            LoadOverrideFile(path, rows);
+
+        ParseOverrideString(sConfigMgr->GetOption<std::string>(optionName, "", false), optionName, rows);
+        return rows;
+    }
+
+    // Builds the lookup tables from database rows followed by config rows,
+    // so the config file wins when both name the same id or regions overlap.
+    void BuildOverrideTables(OutdoorScalingConfig& config)
+    {
+        std::array<OverrideRows, MAX_OVERRIDE_KINDS> merged;
+        for (uint8 kind = 0; kind < MAX_OVERRIDE_KINDS; ++kind)
+        {
+            if (config.database)
+                merged[kind] = config.database->rows[kind];
+
+            merged[kind].insert(merged[kind].end(), config.configRows[kind].begin(), config.configRows[kind].end());
+        }
+
+        config.zoneOverrides.Build(merged[OVERRIDE_KIND_ZONE]);
+        config.areaOverrides.Build(merged[OVERRIDE_KIND_AREA]);
+        config.creatureOverrides.Build(merged[OVERRIDE_KIND_CREATURE]);
+
+        config.mergedRegionRows.clear();
+        if (config.database)
+            config.mergedRegionRows = config.database->regions;
+
+        config.mergedRegionRows.insert(config.mergedRegionRows.end(), config.regionRows.begin(), config.regionRows.end());
+        config.regionOverrides.Build(config.mergedRegionRows);
+    }
+
+    // Compiles the level curves into per-level lookup tables; all the
+    // interpolation happens here, at load.
+    void BuildLevelTables(OutdoorScalingConfig& config, std::array<OverrideRows, MAX_OUTDOOR_EXPANSIONS> const& levelRows,
+        std::array<LevelDeltaRows, MAX_OUTDOOR_EXPANSIONS> const& deltaRows)
+    {
+        for (uint8 expansion = 0; expansion < MAX_OUTDOOR_EXPANSIONS; ++expansion)
+        {
+            MultiplierCurve levelCurve;
+            levelCurve.Build(levelRows[expansion]);
+            config.levelCurveEnabled[expansion] = !levelCurve.points.empty();
+            for (uint32 level = 0; level <= MAX_SCALING_LEVEL; ++level)
+                config.levelCurve[expansion][level] = levelCurve.Evaluate(level);
+
+            // Shift deltas into the unsigned key range the curve works on.
+            OverrideRows shifted;
+            for (LevelDeltaRow const& row : deltaRows[expansion])
+            {
+                int32 key = std::clamp(row.delta, -LEVEL_DELTA_OFFSET, LEVEL_DELTA_OFFSET) + LEVEL_DELTA_OFFSET;
+                shifted.push_back({ uint32(key), { 1.0f, row.damage } });
+            }
+
+            MultiplierCurve deltaCurve;
+            deltaCurve.Build(std::move(shifted));
+            config.levelDeltaEnabled[expansion] = !deltaCurve.points.empty();
+            config.anyLevelDelta = config.anyLevelDelta || config.levelDeltaEnabled[expansion];
+            for (uint32 key = 0; key <= 2 * LEVEL_DELTA_OFFSET; ++key)
+                config.levelDeltaDamage[expansion][key] = deltaCurve.Evaluate(key).damage;
+        }
+    }
+
+    // Builds the profiles named in OutdoorScaling.Profiles from the finished
+    // snapshot: a profile copies it, replaces the continent values it sets
+    // and layers its own override rows over the loaded ones.
+    void BuildProfiles(OutdoorScalingConfig& config)
+    {
+        std::vector<std::shared_ptr<OutdoorScalingConfig>> profiles;
+
+        std::string const names = sConfigMgr->GetOption<std::string>("OutdoorScaling.Profiles", "", false);
+        std::string_view input(names);
+        while (!input.empty())
+        {
+            std::size_t comma = input.find(',');
+            std::string_view chunk = input.substr(0, comma);
+            input.remove_prefix(comma == std::string_view::npos ? input.size() : comma + 1);
+
+            std::string const name(NextToken(chunk));
+            if (name.empty())
+                continue;
+
+            if (name == config.profileName || std::any_of(profiles.begin(), profiles.end(), [&name](auto const& profile) { return profile->profileName == name; }))
+            {
+                LOG_ERROR("module", "OutdoorScaling: profile '{}' ignored: name already in use.", name);
+                continue;
+            }
+
+            std::string const prefix = "OutdoorScaling.Profile." + name + ".";
+            auto profile = std::make_shared<OutdoorScalingConfig>(config);
+            profile->profileName = name;
+            profile->schedule = LoadConfigOverrides<ScheduleWindows>(prefix + "Schedule");
+            if (profile->schedule.empty())
+                LOG_ERROR("module", "OutdoorScaling: profile '{}' has no schedule and will never be active.", name);
+
+            for (uint8 expansion = 0; expansion < MAX_OUTDOOR_EXPANSIONS; ++expansion)
+            {
+                std::string const index = std::to_string(expansion);
+                profile->continentHealth[expansion] = sConfigMgr->GetOption<float>(prefix + "Continent." + index + ".Health", config.continentHealth[expansion], false);
+                profile->continentDamage[expansion] = sConfigMgr->GetOption<float>(prefix + "Continent." + index + ".Damage", config.continentDamage[expansion], false);
+            }
+
+            auto append = [](auto& rows, auto const& more) { rows.insert(rows.end(), more.begin(), more.end()); };
+            append(profile->configRows[OVERRIDE_KIND_ZONE], LoadConfigOverrides<OverrideRows>(prefix + "ZoneOverrides"));
+            append(profile->configRows[OVERRIDE_KIND_AREA], LoadConfigOverrides<OverrideRows>(prefix + "AreaOverrides"));
+            append(profile->configRows[OVERRIDE_KIND_CREATURE], LoadConfigOverrides<OverrideRows>(prefix + "CreatureOverrides"));
+            append(profile->regionRows, LoadConfigOverrides<RegionRows>(prefix + "RegionOverrides"));
+
+            BuildOverrideTables(*profile);
+            BuildFactorTables(*profile);
+            profiles.push_back(std::move(profile));
+        }
+
+        config.profiles = std::move(profiles);
+    }
+
+    // First profile, in OutdoorScaling.Profiles order, whose schedule covers
+    // the given local time; 0 (the loaded snapshot) if none does.
+    uint32 SelectProfile(OutdoorScalingConfig const& base, std::tm const& now)
+    {
+        uint16 minute = uint16(now.tm_hour * 60 + now.tm_min);
+        for (std::size_t i = 0; i < base.profiles.size(); ++i)
+            for (ScheduleWindow const& window : base.profiles[i]->schedule)
+                if (window.Contains(uint8(now.tm_wday), minute))
+                    return uint32(i + 1);
+
+        return 0;
+    }
+
+    uint32 SelectProfile(OutdoorScalingConfig const& base)
+    {
+        return base.profiles.empty() ? 0 : SelectProfile(base, Acore::Time::TimeBreakdown(GameTime::GetGameTime().count()));
+    }
+
+    std::shared_ptr<DatabaseOverrides const> ReadDatabaseOverrides(QueryResult result)
+    {
+        auto database = std::make_shared<DatabaseOverrides>();
+        if (!result)
+            return database;
+
+        uint32 rejected = 0;
+        do
+        {
+            Field* fields = result->Fetch();
+            uint8 kind = fields[0].Get<uint8>();
+
+            OverrideRow row;
+            row.id = fields[1].Get<uint32>();
+            row.mults.health = fields[2].Get<float>();
+            row.mults.damage = fields[3].Get<float>();
+
+            if (kind > OVERRIDE_KIND_REGION || row.mults.health <= 0.0f || row.mults.damage <= 0.0f)
+            {
+                if (++rejected <= MAX_REPORTED_ROW_ERRORS)
+                    LOG_ERROR("module", "OutdoorScaling: mod_outdoor_scaling_overrides row (Type {}, Id {}) ignored: unknown type or multiplier <= 0.", kind, row.id);
+                continue;
+            }
+
+            if (kind != OVERRIDE_KIND_REGION)
+            {
+                database->rows[kind].push_back(row);
+                continue;
+            }
+
+            // A circle around (X1, Y1) when Radius is set, else the rectangle.
+            RegionRow region;
+            region.mapId = fields[4].Get<uint32>();
+            region.mults = row.mults;
+            float radius = fields[9].Get<float>();
+            if (radius > 0.0f)
+            {
+                region.shape = RegionShape::Circle;
+                region.coords = { fields[5].Get<float>(), fields[6].Get<float>(), radius, 0.0f };
+            }
+            else
+            {
+                region.shape = RegionShape::Rect;
+                region.coords = { fields[5].Get<float>(), fields[6].Get<float>(), fields[7].Get<float>(), fields[8].Get<float>() };
+            }
+
+            if (region.shape == RegionShape::Rect && (region.coords[0] > region.coords[2] || region.coords[1] > region.coords[3]))
+            {
+                if (++rejected <= MAX_REPORTED_ROW_ERRORS)
+                    LOG_ERROR("module", "OutdoorScaling: mod_outdoor_scaling_overrides region {} ignored: X1 > X2 or Y1 > Y2.", row.id);
+                continue;
+            }
+
+            database->regions.push_back(region);
+        } while (result->NextRow());
+
+        if (rejected > MAX_REPORTED_ROW_ERRORS)
+            LOG_ERROR("module", "OutdoorScaling: mod_outdoor_scaling_overrides had {} more rejected rows.", rejected - MAX_REPORTED_ROW_ERRORS);
+
+        return database;
+    }
+
+    // Precedence: creature, region (x, y on the map), area, zone, level
+    // curve, continent. Fills the multipliers and factors before population;
+    // result.expansion must be set.
+    void ResolveOverrides(OutdoorScalingConfig const& config, ScalingQuery const& query, uint32 mapId, uint8 rank, bool withRegions, ScalingResult& result)
+    {
+        OverrideMults const* overrideMults = config.creatureOverrides.Find(query.entry);
+        if (overrideMults)
+            result.source = OutdoorScalingInfo::Source::CreatureOverride;
+        else if (withRegions && (overrideMults = config.regionOverrides.Find(mapId, query.x, query.y)))
+            result.source = OutdoorScalingInfo::Source::RegionOverride;
+        else if ((overrideMults = config.areaOverrides.Find(query.areaId)))
+            result.source = OutdoorScalingInfo::Source::AreaOverride;
+        else if ((overrideMults = config.zoneOverrides.Find(query.zoneId)))
+            result.source = OutdoorScalingInfo::Source::ZoneOverride;
+        else if (config.levelCurveEnabled[result.expansion])
+        {
+            overrideMults = &config.levelCurve[result.expansion][std::min(query.level, MAX_SCALING_LEVEL)];
+            result.source = OutdoorScalingInfo::Source::LevelCurve;
+        }
+
+        if (overrideMults)
+        {
+            result.healthMult = overrideMults->health * config.rankHealth[rank];
+            result.damageMult = overrideMults->damage * config.rankDamage[rank];
+            result.factors = ToFactors(config, rank, result.healthMult, result.damageMult);
+        }
+        else
+        {
+            result.healthMult = config.continentHealth[result.expansion] * config.rankHealth[rank];
+            result.damageMult = config.continentDamage[result.expansion] * config.rankDamage[rank];
+            result.factors = config.continentFactors[result.expansion][rank];
+            result.source = OutdoorScalingInfo::Source::Continent;
+        }
+    }
+
+    ScalingResult ComputeScaling(OutdoorScalingConfig const& config, ScalingQuery const& query)
+    {
+        Map* map = query.map;
+        ScalingResult result;
+        result.zoneId = query.zoneId;
+        result.areaId = query.areaId;
+
+        if (!config.enabled)
+        {
+            result.source = OutdoorScalingInfo::Source::Disabled;
+            return result;
+        }
+
+        if (!map || !IsOutdoorContinent(map))
+        {
+            result.source = OutdoorScalingInfo::Source::NotOutdoor;
+            return result;
+        }
+
+        if (query.isPetOrGuardian)
+        {
+            result.source = OutdoorScalingInfo::Source::PetOrGuardian;
+            return result;
+        }
+
+        MapEntry const* entry = map->GetEntry();
+        result.expansion = entry ? ClampExpansion(entry->Expansion()) : 0;
+
+        uint8 rank = ClampRank(query.rank);
+
+        ResolveOverrides(config, query, map->GetId(), rank, true, result);
+
+        // Population stacks on top of whichever source applies.
+        if (config.populationEnabled)
+        {
+            OverrideMults population = config.populationCurve.Evaluate(gPopulation.Effective(map->GetId(), query.zoneId));
+            if (population.health != 1.0f || population.damage != 1.0f)
+            {
+                result.healthMult *= population.health;
+                result.damageMult *= population.damage;
+                result.factors = ToFactors(config, rank, result.healthMult, result.damageMult);
+            }
+        }
+
+        return result;
+    }
+
+    ScalingQuery MakeScalingQuery(Creature* creature)
+    {
+        ScalingQuery query;
+        query.map = creature->GetMap();
+        query.zoneId = creature->GetZoneId();
+        query.areaId = creature->GetAreaId();
+        query.x = creature->GetPositionX();
+        query.y = creature->GetPositionY();
+        query.entry = creature->GetEntry();
+        query.rank = uint8(creature->GetCreatureTemplate()->rank);
+        query.level = creature->GetLevel();
+        query.isPetOrGuardian = creature->IsPet() || creature->IsGuardian();
+        return query;
+    }
+
+    ScalingResult ComputeScaling(OutdoorScalingConfig const& config, Creature* creature)
+    {
+        return ComputeScaling(config, MakeScalingQuery(creature));
+    }
+
+    // Extra damage multiplier for a scaled creature hitting a player, by their
+    // level difference. One table index; 1 when no delta curve is configured.
+    float LevelDeltaDamage(OutdoorScalingConfig const& config, OutdoorScalingInfo const* info, Unit const* attacker, Unit const* target)
+    {
+        if (!config.levelDeltaEnabled[info->expansion] || !target || !target->IsPlayer() || !IsScaledSource(info->source))
+            return 1.0f;
+
+        int32 delta = int32(attacker->GetLevel()) - int32(target->GetLevel());
+        return config.levelDeltaDamage[info->expansion][std::clamp(delta, -LEVEL_DELTA_OFFSET, LEVEL_DELTA_OFFSET) + LEVEL_DELTA_OFFSET];
+    }
+
+    void AssignScaling(OutdoorScalingInfo* info, ScalingResult const& scaling, OutdoorScalingConfig const& config, ScalingAggregates& aggregates)
+    {
+        OutdoorScalingInfo const previous = *info;
+
+        info->healthMult = scaling.healthMult;
+        info->damageMult = scaling.damageMult;
+        info->spellDamageFactor = scaling.factors[SCALING_STAT_SPELL_DAMAGE];
+        info->areaId = scaling.areaId;
+        info->expansion = scaling.expansion;
+        info->source = scaling.source;
+        info->generation = config.generation;
+
+        if (previous.generation)
+            aggregates.Replace(previous, *info);
+        else
+            aggregates.Add(*info);
+    }
+
+    // Records the factors baked into the creature's stats and the max health
+    // they account for.
+    void SetApplied(OutdoorScalingInfo* info, float healthFactor, float damageFactor, int32 healthDelta, ScalingAggregates& aggregates)
+    {
+        OutdoorScalingInfo const previous = *info;
+
+        info->appliedHealthFactor = healthFactor;
+        info->appliedDamageFactor = damageFactor;
+        info->appliedHealthDelta = healthDelta;
+
+        if (info->generation)
+            aggregates.Replace(previous, *info);
+    }
+
+    // Resolves scaling for the creature and stores it in its OutdoorScalingInfo.
+    // Regions match the creature's position at resolve time, which is its
+    // spawn point for the stats applied on spawn.
+    ScalingResult StoreScaling(Creature* creature, OutdoorScalingConfig const& config, CreatureScalingTable& table, OutdoorScalingInfo* info)
+    {
+        ScalingResult scaling = ComputeScaling(config, creature);
+        AssignScaling(info, scaling, config, table.Aggregates());
+        CountResolve(config, scaling.source);
+
+        return scaling;
+    }
+
+    void ApplyDamageScale(Creature* creature, float factor)
+    {
+        if (factor == 1.0f)
+            return;
+
+        float baseMin = creature->GetWeaponDamageRange(BASE_ATTACK, MINDAMAGE);
+        float baseMax = creature->GetWeaponDamageRange(BASE_ATTACK, MAXDAMAGE);
+        float offMin  = creature->GetWeaponDamageRange(OFF_ATTACK, MINDAMAGE);
+        float offMax  = creature->GetWeaponDamageRange(OFF_ATTACK, MAXDAMAGE);
+        float rngMin  = creature->GetWeaponDamageRange(RANGED_ATTACK, MINDAMAGE);
+        float rngMax  = creature->GetWeaponDamageRange(RANGED_ATTACK, MAXDAMAGE);
+
+        creature->SetBaseWeaponDamage(BASE_ATTACK, MINDAMAGE, baseMin * factor);
+        creature->SetBaseWeaponDamage(BASE_ATTACK, MAXDAMAGE, baseMax * factor);
+        creature->SetBaseWeaponDamage(OFF_ATTACK, MINDAMAGE, offMin * factor);
+        creature->SetBaseWeaponDamage(OFF_ATTACK, MAXDAMAGE, offMax * factor);
+        creature->SetBaseWeaponDamage(RANGED_ATTACK, MINDAMAGE, rngMin * factor);
+        creature->SetBaseWeaponDamage(RANGED_ATTACK, MAXDAMAGE, rngMax * factor);
+    }
+
+    // Re-resolves a creature whose stats are already scaled and re-scales
+    // them relative to the factors applied before, keeping its current
+    // health percentage.
+    void RescaleStats(Creature* creature, OutdoorScalingConfig const& config, CreatureScalingTable& table, OutdoorScalingInfo* info)
+    {
+        ScalingResult scaling = StoreScaling(creature, config, table, info);
+        info->appliedGeneration = config.generation;
+        bool scaled = IsScaledSource(scaling.source);
+        float healthFactor = scaled ? scaling.factors[SCALING_STAT_HEALTH] : 1.0f;
+        float damageFactor = scaled ? scaling.factors[SCALING_STAT_DAMAGE] : 1.0f;
+
+        bool healthChanged = healthFactor != info->appliedHealthFactor && info->appliedHealthFactor > 0.0f;
+        bool damageChanged = damageFactor != info->appliedDamageFactor && info->appliedDamageFactor > 0.0f;
+        if (!healthChanged && !damageChanged)
+            return;
+
+        float healthPct = creature->GetHealthPct();
+        int32 healthDelta = info->appliedHealthDelta;
+
+        if (healthChanged)
+        {
+            uint32 oldMaxHealth = creature->GetCreateHealth();
+            uint32 newMaxHealth = uint32(float(oldMaxHealth) / info->appliedHealthFactor * healthFactor);
+            if (!newMaxHealth)
+                newMaxHealth = 1;
+
+            creature->SetCreateHealth(newMaxHealth);
+            creature->SetStatFlatModifier(UNIT_MOD_HEALTH, BASE_VALUE, float(newMaxHealth));
+            healthDelta += int32(newMaxHealth) - int32(oldMaxHealth);
+        }
+        else
+            healthFactor = info->appliedHealthFactor;
+
+        if (damageChanged)
+            ApplyDamageScale(creature, damageFactor / info->appliedDamageFactor);
+        else
+            damageFactor = info->appliedDamageFactor;
+
+        SetApplied(info, healthFactor, damageFactor, healthDelta, table.Aggregates());
+
+        creature->UpdateAllStats();
+
+        if (creature->IsAlive())
+            creature->SetHealth(std::max<uint32>(1, creature->CountPctFromMaxHealth(healthPct)));
+    }
+
+    template<class Worker>
+    struct CreatureStoreVisitor
+    {
+        Worker& worker;
+
+        void Visit(std::unordered_map<ObjectGuid, Creature*>& creatures)
+        {
+            for (auto const& [guid, creature] : creatures)
+                worker(creature);
+        }
+
+        template<class T>
+        void Visit(std::unordered_map<ObjectGuid, T*>& /*objects*/) { }
+    };
+
+    // Every creature on the map, summons and other creatures without a spawn
+    // included; the spawn id store only holds database spawns.
+    template<class Worker>
+    void ForEachCreature(Map* map, Worker&& worker)
+    {
+        CreatureStoreVisitor<Worker> storeVisitor{ worker };
+        TypeContainerVisitor<CreatureStoreVisitor<Worker>, MapStoredObjectTypesContainer> visitor(storeVisitor);
+        visitor.Visit(map->GetObjectsStore());
+    }
+
+    OutdoorScalingMapInfo* GetMapInfo(Map* map, OutdoorScalingConfig const& config)
+    {
+        OutdoorScalingMapInfo* mapInfo = map->CustomData.Get<OutdoorScalingMapInfo>("OutdoorScalingMapInfo");
+        if (!mapInfo)
+        {
+            // Everything on a new map spawned with the current config.
+            mapInfo = map->CustomData.GetDefault<OutdoorScalingMapInfo>("OutdoorScalingMapInfo");
+            mapInfo->generation = config.generation;
+            mapInfo->baseGeneration = config.baseGeneration;
+            mapInfo->populationEpoch = gPopulation.Epoch();
+        }
+
+        return mapInfo;
+    }
+
+    // Continent maps live as long as the world and there are only a few of
+    // them, so each thread remembers the ones it looked up last instead of
+    // going through CustomData.
+    OutdoorScalingMapInfo* GetContinentMapInfo(Map* map, OutdoorScalingConfig const& config)
+    {
+        thread_local std::array<std::pair<Map const*, OutdoorScalingMapInfo*>, 8> recent{};
+        thread_local std::size_t next = 0;
+        for (auto const& [recentMap, mapInfo] : recent)
+            if (recentMap == map)
+                return mapInfo;
+
+        OutdoorScalingMapInfo* mapInfo = GetMapInfo(map, config);
+        recent[next] = { map, mapInfo };
+        next = (next + 1) % recent.size();
+        return mapInfo;
+    }
+
+    // Continent creatures keep a scaling record in their map's table. Pets
+    // and creatures elsewhere always resolve to an unscaled outcome and have
+    // none; nullptr for those.
+    CreatureScalingTable* GetScalingTable(Creature* creature, OutdoorScalingConfig const& config)
+    {
+        Map* map = creature->GetMap();
+        if (!IsOutdoorContinent(map) || creature->GetGUID().IsPet())
+            return nullptr;
+
+        OutdoorScalingMapInfo* mapInfo = GetContinentMapInfo(map, config);
+        return creature->GetGUID().IsVehicle() ? &mapInfo->vehicleScaling : &mapInfo->creatureScaling;
+    }
+
+    // Shared read-only record for a creature without one of its own.
+    OutdoorScalingInfo const* GetUnscaledInfo(Creature* creature, OutdoorScalingConfig const& config)
+    {
+        static std::array<OutdoorScalingInfo, MAX_SCALING_SOURCES> const infos = []()
+        {
+            std::array<OutdoorScalingInfo, MAX_SCALING_SOURCES> result;
+            for (uint8 source = 0; source < MAX_SCALING_SOURCES; ++source)
+                result[source].source = OutdoorScalingInfo::Source(source);
+
+            return result;
+        }();
+
+        if (!config.enabled)
+            return &infos[uint8(OutdoorScalingInfo::Source::Disabled)];
+
+        if (!IsOutdoorContinent(creature->GetMap()))
+            return &infos[uint8(OutdoorScalingInfo::Source::NotOutdoor)];
+
+        return &infos[uint8(OutdoorScalingInfo::Source::PetOrGuardian)];
+    }
+
+    // The creature's scaling record as last resolved, without resolving it.
+    OutdoorScalingInfo const* FindScaling(Creature* creature, OutdoorScalingConfig const& config)
+    {
+        if (CreatureScalingTable* table = GetScalingTable(creature, config))
+            return table->Find(creature->GetGUID().GetCounter());
+
+        return GetUnscaledInfo(creature, config);
+    }
+
+    // Re-scales a live creature to the given config.
+    void ReapplyScaling(Creature* creature, OutdoorScalingConfig const& config)
+    {
+        CreatureScalingTable* table = GetScalingTable(creature, config);
+        if (!table)
+            return;
+
+        OutdoorScalingInfo* info = table->Find(creature->GetGUID().GetCounter());
+        if (!info)
+            return;
+
+        RescaleStats(creature, config, *table, info);
+    }
+
+    // Returns the cached scaling for the creature, resolving it again only if
+    // the config was reloaded, the active profile changed, or the creature
+    // changed area since the last resolve. Only the record is updated:
+    // callers are partway through a damage or heal calculation, so stats are
+    // re-scaled later, by the map's reapply queue after a reload or at the
+    // creature's next update after a profile switch. A zone's population
+    // change reaches its creatures through the queue alone.
+    OutdoorScalingInfo const* GetScaling(Creature* creature, OutdoorScalingConfig const& config)
+    {
+        CreatureScalingTable* table = GetScalingTable(creature, config);
+        if (!table)
+            return GetUnscaledInfo(creature, config);
+
+        ObjectGuid::LowType counter = creature->GetGUID().GetCounter();
+        OutdoorScalingInfo* info = table->Find(counter);
+        if (info && info->generation == config.generation && info->areaId == creature->GetAreaId())
+            return info;
+
+        if (!info)
+            info = &table->Acquire(counter);
+
+        StoreScaling(creature, config, *table, info);
+        return info;
+    }
+
+    std::string SourceToString(OutdoorScalingInfo::Source source)
+    {
+        switch (source)
+        {
+            case OutdoorScalingInfo::Source::Continent:       return "Continent default";
+            case OutdoorScalingInfo::Source::LevelCurve:      return "Level curve";
+            case OutdoorScalingInfo::Source::ZoneOverride:    return "Zone override";
+            case OutdoorScalingInfo::Source::AreaOverride:    return "Area override";
+            case OutdoorScalingInfo::Source::RegionOverride:  return "Region override";
+            case OutdoorScalingInfo::Source::CreatureOverride:return "Creature override";
+            case OutdoorScalingInfo::Source::Disabled:        return "Module disabled";
+            case OutdoorScalingInfo::Source::NotOutdoor:      return "Not outdoor continent";
+            case OutdoorScalingInfo::Source::PetOrGuardian:   return "Pet/guardian excluded";
+            default:                                          return "Not scaled";
+        }
+    }
+
+    // One creature's scaling state as captured by .os dump.
+    struct DumpRow
+    {
+        uint32 mapId = 0;
+        uint32 instanceId = 0;
+        ObjectGuid::LowType spawnId = 0;
+        uint32 entry = 0;
+        uint32 zoneId = 0;
+        uint32 areaId = 0;
+        float x = 0.0f;
+        float y = 0.0f;
+        uint8 level = 0;
+        uint8 rank = 0;
+        OutdoorScalingInfo::Source source = OutdoorScalingInfo::Source::None;
+        float healthMult = 1.0f;
+        float damageMult = 1.0f;
+        float spellDamageFactor = 1.0f;
+        // What is baked into maxHealth and the weapon damage below; differs
+        // from the multipliers above until a re-resolve is re-applied.
+        float appliedHealthFactor = 1.0f;
+        float appliedDamageFactor = 1.0f;
+        uint32 maxHealth = 0;
+        float minDamage = 0.0f;
+        float maxDamage = 0.0f;
+    };
+
+    // .os dump: every map copies its creatures' state into a chunk during its
+    // own update and queues it; a background task streams the chunks to a CSV
+    // file. Map threads only take a short lock to queue a chunk and never wait
+    // on the file.
+    class ScalingDump
+    {
+    public:
+        // A map instance, as (map id, instance id).
+        using MapKey = std::pair<uint32, uint32>;
+
+        // World thread only. Returns false if the previous dump is not done.
+        // Every map loaded now has to report before the file is closed.
+        bool Start(std::string const& path)
+        {
+            if (_writer.valid())
+                return false;
+
+            _targets.clear();
+            sMapMgr->DoForAllMaps([this](Map* map) { _targets.emplace_back(map->GetId(), map->GetInstanceId()); });
+            std::sort(_targets.begin(), _targets.end());
+
+            {
+                std::lock_guard<std::mutex> guard(_lock);
+                _chunks.clear();
+                _reported.clear();
+                _closed = false;
+            }
+
+            _path = path;
+            _elapsedMs = 0;
+            _missing.clear();
+            _maps.store(0, std::memory_order_relaxed);
+            _rowsWritten.store(0, std::memory_order_relaxed);
+            _writer = std::async(std::launch::async, &ScalingDump::Write, this, path);
+            _collectingId.store(++_lastId, std::memory_order_release);
+            return true;
+        }
+
+        // Id of the dump maps should contribute to, 0 if none is collecting.
+        uint32 CollectingId() const { return _collectingId.load(std::memory_order_acquire); }
+
+        void Submit(MapKey map, std::vector<DumpRow> rows)
+        {
+            {
+                std::lock_guard<std::mutex> guard(_lock);
+                if (_closed)
+                    return;
+
+                _chunks.push_back(std::move(rows));
+                _reported.push_back(map);
+            }
+
+            _maps.fetch_add(1, std::memory_order_relaxed);
+            _wakeWriter.notify_one();
+        }
+
+        // World thread only, once per world update. Collection ends once
+        // every map loaded at the request has reported or been unloaded, or
+        // after CollectTimeoutMs; maps still missing then are logged.
+        void Update(uint32 diff)
+        {
+            if (CollectingId())
+            {
+                _elapsedMs += diff;
+                std::vector<MapKey> waiting = Waiting();
+                if (waiting.empty() || _elapsedMs >= CollectTimeoutMs)
+                {
+                    _collectingId.store(0, std::memory_order_release);
+                    {
+                        std::lock_guard<std::mutex> guard(_lock);
+                        _closed = true;
+                    }
+
+                    _wakeWriter.notify_one();
+
+                    _missing = std::move(waiting);
+                    if (!_missing.empty())
+                        LOG_WARN("module", "OutdoorScaling: dump '{}' stopped waiting after {} s; {} maps did not report: {}.",
+                            _path, CollectTimeoutMs / IN_MILLISECONDS, _missing.size(), MapsToString(_missing));
+                }
+            }
+
+            if (_writer.valid() && _writer.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                if (_writer.get())
+                {
+                    if (_missing.empty())
+                        LOG_INFO("module", "OutdoorScaling: dumped {} creatures from {} maps to '{}'.", RowsWritten(), Maps(), _path);
+                    else
+                        LOG_INFO("module", "OutdoorScaling: dumped {} creatures from {} maps to '{}'; missing {} maps: {}.",
+                            RowsWritten(), Maps(), _path, _missing.size(), MapsToString(_missing));
+                }
+            }
+        }
+
+        // World thread only. Maps loaded at the request that are still loaded
+        // and have not reported yet.
+        std::vector<MapKey> Waiting() const
+        {
+            std::vector<MapKey> reported;
+            {
+                std::lock_guard<std::mutex> guard(_lock);
+                reported = _reported;
+            }
+
+            std::sort(reported.begin(), reported.end());
+
+            std::vector<MapKey> waiting;
+            sMapMgr->DoForAllMaps([&](Map* map)
+            {
+                MapKey key(map->GetId(), map->GetInstanceId());
+                if (std::binary_search(_targets.begin(), _targets.end(), key) && !std::binary_search(reported.begin(), reported.end(), key))
+                    waiting.push_back(key);
+            });
+
+            std::sort(waiting.begin(), waiting.end());
+            return waiting;
+        }
+
+        static std::string MapsToString(std::vector<MapKey> const& maps)
+        {
+            std::string text;
+            for (MapKey const& map : maps)
+            {
+                if (!text.empty())
+                    text.append(", ");
+
+                text.append(std::to_string(map.first));
+                if (map.second)
+                    text.append("/").append(std::to_string(map.second));
+            }
+
+            return text;
+        }
+
+        bool Running() const { return _writer.valid(); }
+        bool Collecting() const { return CollectingId() != 0; }
+        std::string const& Path() const { return _path; }
+        uint32 Maps() const { return _maps.load(std::memory_order_relaxed); }
+        uint64 RowsWritten() const { return _rowsWritten.load(std::memory_order_relaxed); }
+
+    private:
+        // Runs off the world thread until collection has ended and every
+        // queued chunk is written.
+        bool Write(std::string path)
+        {
+            std::error_code error;
+            std::filesystem::create_directories(std::filesystem::path(path).parent_path(), error);
+
+            std::ofstream file(path, std::ios::trunc);
+            if (!file)
+                LOG_ERROR("module", "OutdoorScaling: could not open dump file '{}'.", path);
+            else
+                file << "map,instance,spawn_id,entry,level,rank,zone,area,x,y,source,health_mult,damage_mult,spell_damage_factor,applied_health_factor,applied_damage_factor,max_health,min_damage,max_damage\n";
+
+            std::vector<std::vector<DumpRow>> chunks;
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> guard(_lock);
+                    _wakeWriter.wait(guard, [this]() { return _closed || !_chunks.empty(); });
+                    chunks.swap(_chunks);
+                    if (chunks.empty() && _closed)
+                        break;
+                }
+
+                for (std::vector<DumpRow> const& chunk : chunks)
+                {
+                    if (file)
+                    {
+                        for (DumpRow const& row : chunk)
+                        {
+                            file << row.mapId << ',' << row.instanceId << ',' << row.spawnId << ',' << row.entry << ','
+                                << uint32(row.level) << ',' << uint32(row.rank) << ',' << row.zoneId << ',' << row.areaId << ','
+                                << row.x << ',' << row.y << ',' << SourceToString(row.source) << ','
+                                << row.healthMult << ',' << row.damageMult << ',' << row.spellDamageFactor << ','
+                                << row.appliedHealthFactor << ',' << row.appliedDamageFactor << ','
+                                << row.maxHealth << ',' << row.minDamage << ',' << row.maxDamage << '\n';
+                        }
+                    }
+
+                    _rowsWritten.fetch_add(chunk.size(), std::memory_order_relaxed);
+                }
+
+                chunks.clear();
+            }
+
+            file.flush();
+            return bool(file);
+        }
+
+        // A map that has not updated for this long (a stalled map thread)
+        // is left out rather than holding the dump open.
+        static constexpr uint32 CollectTimeoutMs = 30 * IN_MILLISECONDS;
+
+        std::atomic<uint32> _collectingId{ 0 };
+        std::atomic<uint32> _maps{ 0 };
+        std::atomic<uint64> _rowsWritten{ 0 };
+
+        mutable std::mutex _lock;
+        std::condition_variable _wakeWriter;
+        // Guarded by _lock.
+        std::vector<std::vector<DumpRow>> _chunks;
+        std::vector<MapKey> _reported;
+        bool _closed = false;
+
+        // World thread only.
+        std::future<bool> _writer;
+        std::string _path;
+        uint32 _lastId = 0;
+        uint32 _elapsedMs = 0;
+        // Sorted.
+        std::vector<MapKey> _targets;
+        std::vector<MapKey> _missing;
+    };
+
+    ScalingDump gDump;
+
+    // Copies the map's creatures for the collecting dump, summons included
+    // with spawn id 0. Only reads what is cached on each creature; nothing is
+    // resolved or scaled here.
+    void DumpMap(Map* map, OutdoorScalingMapInfo& mapInfo, uint32 dumpId)
+    {
+        mapInfo.dumpId = dumpId;
+        OutdoorScalingConfig const& config = gConfigStore.Get();
+
+        std::vector<DumpRow> rows;
+        rows.reserve(map->GetCreatureBySpawnIdStore().size());
+
+        ForEachCreature(map, [map, &config, &rows](Creature* creature)
+        {
+            DumpRow& row = rows.emplace_back();
+            row.mapId = map->GetId();
+            row.instanceId = map->GetInstanceId();
+            row.spawnId = creature->GetSpawnId();
+            row.entry = creature->GetEntry();
+            row.zoneId = creature->GetZoneId();
+            row.areaId = creature->GetAreaId();
+            row.x = creature->GetPositionX();
+            row.y = creature->GetPositionY();
+            row.level = creature->GetLevel();
+            row.rank = uint8(creature->GetCreatureTemplate()->rank);
+            row.maxHealth = creature->GetMaxHealth();
+            row.minDamage = creature->GetWeaponDamageRange(BASE_ATTACK, MINDAMAGE);
+            row.maxDamage = creature->GetWeaponDamageRange(BASE_ATTACK, MAXDAMAGE);
+
+            if (OutdoorScalingInfo const* info = FindScaling(creature, config))
+            {
+                row.source = info->source;
+                row.healthMult = info->healthMult;
+                row.damageMult = info->damageMult;
+                row.spellDamageFactor = info->spellDamageFactor;
+                row.appliedHealthFactor = info->appliedHealthFactor;
+                row.appliedDamageFactor = info->appliedDamageFactor;
+            }
+        });
+
+        gDump.Submit({ map->GetId(), map->GetInstanceId() }, std::move(rows));
+    }
+
+    // Creature templates and their spawns as listed in the world database,
+    // read once for the override report.
+    struct SpawnCensus
+    {
+        struct Spawn
+        {
+            uint32 entry = 0;
+            uint32 mapId = 0;
+            uint32 zoneId = 0;
+            uint32 areaId = 0;
+            float x = 0.0f;
+            float y = 0.0f;
+            // Saved health of the spawn, for the 1 HP check.
+            uint32 health = 0;
+            uint8 expansion = 0;
+            uint8 rank = 0;
+            uint8 minLevel = 0;
+            uint8 maxLevel = 0;
+        };
+
+        // Spawns on outdoor continents.
+        std::vector<Spawn> spawns;
+        // All sorted and unique: template entries, entries spawned outdoors,
+        // zones and areas with outdoor spawns and those with spawns elsewhere.
+        std::vector<uint32> entries;
+        std::vector<uint32> spawnedEntries;
+        std::vector<uint32> zones;
+        std::vector<uint32> areas;
+        std::vector<uint32> otherZones;
+        std::vector<uint32> otherAreas;
+    };
+
+    void SortUnique(std::vector<uint32>& ids)
+    {
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    }
+
+    bool Contains(std::vector<uint32> const& sortedIds, uint32 id)
+    {
+        return std::binary_search(sortedIds.begin(), sortedIds.end(), id);
+    }
+
+    std::shared_ptr<SpawnCensus const> ReadSpawnCensus(QueryResult result)
+    {
+        auto census = std::make_shared<SpawnCensus>();
+        if (!result)
+            return census;
+
+        do
+        {
+            Field* fields = result->Fetch();
+            uint32 entry = fields[0].Get<uint32>();
+            census->entries.push_back(entry);
+
+            // Templates without spawns come through the join with a NULL map.
+            if (fields[4].IsNull())
+                continue;
+
+            SpawnCensus::Spawn spawn;
+            spawn.entry = entry;
+            spawn.rank = ClampRank(fields[1].Get<uint8>());
+            spawn.minLevel = fields[2].Get<uint8>();
+            spawn.maxLevel = std::max(spawn.minLevel, fields[3].Get<uint8>());
+            spawn.mapId = fields[4].Get<uint16>();
+            spawn.zoneId = fields[5].Get<uint16>();
+            spawn.areaId = fields[6].Get<uint16>();
+            spawn.x = fields[7].Get<float>();
+            spawn.y = fields[8].Get<float>();
+            spawn.health = fields[9].Get<uint32>();
+
+            // Continents are never instanced, so the map entry is enough here.
+            MapEntry const* map = sMapStore.LookupEntry(spawn.mapId);
+            if (!map || !map->IsContinent())
+            {
+                census->otherZones.push_back(spawn.zoneId);
+                census->otherAreas.push_back(spawn.areaId);
+                continue;
+            }
+
+            spawn.expansion = ClampExpansion(map->Expansion());
+            census->spawns.push_back(spawn);
+            census->spawnedEntries.push_back(entry);
+            census->zones.push_back(spawn.zoneId);
+            census->areas.push_back(spawn.areaId);
+        } while (result->NextRow());
+
+        SortUnique(census->entries);
+        SortUnique(census->spawnedEntries);
+        SortUnique(census->zones);
+        SortUnique(census->areas);
+        SortUnique(census->otherZones);
+        SortUnique(census->otherAreas);
+        return census;
+    }
+
+    // A spawn whose scaled health ends at the 1 HP floor, and the override
+    // (or default) responsible for it.
+    struct HealthFloorHit
+    {
+        OutdoorScalingInfo::Source source = OutdoorScalingInfo::Source::None;
+        // Creature entry, region row, area, zone, level or expansion.
+        uint32 id = 0;
+        uint32 entry = 0;
+        uint32 health = 0;
+    };
+
+    struct SpawnChunk
+    {
+        std::vector<uint32> regionHits;
+        std::vector<HealthFloorHit> floorHits;
+    };
+
+    uint32 SourceId(OutdoorScalingInfo::Source source, ScalingQuery const& query, std::size_t region, uint8 expansion)
+    {
+        switch (source)
+        {
+            case OutdoorScalingInfo::Source::CreatureOverride: return query.entry;
+            case OutdoorScalingInfo::Source::RegionOverride:   return uint32(region);
+            case OutdoorScalingInfo::Source::AreaOverride:     return query.areaId;
+            case OutdoorScalingInfo::Source::ZoneOverride:     return query.zoneId;
+            case OutdoorScalingInfo::Source::LevelCurve:       return query.level;
+            default:                                           return expansion;
+        }
+    }
+
+    // Level a spawn is resolved at: 0 unless a level curve applies.
+    uint8 ValidationLevel(OutdoorScalingConfig const& config, uint8 expansion, uint8 level)
+    {
+        return config.levelCurveEnabled[expansion] ? std::min(level, MAX_SCALING_LEVEL) : 0;
+    }
+
+    // Resolves spawns [first, last) for every level they can spawn at.
+    void ResolveSpawnChunk(OutdoorScalingConfig const& config, SpawnCensus::Spawn const* first, SpawnCensus::Spawn const* last, SpawnChunk& chunk)
+    {
+        std::size_t const noRegion = config.regionOverrides.Size();
+        chunk.regionHits.assign(noRegion, 0);
+
+        for (SpawnCensus::Spawn const* spawn = first; spawn != last; ++spawn)
+        {
+            ScalingQuery query;
+            query.zoneId = spawn->zoneId;
+            query.areaId = spawn->areaId;
+            query.x = spawn->x;
+            query.y = spawn->y;
+            query.entry = spawn->entry;
+            query.rank = spawn->rank;
+
+            std::size_t region = config.creatureOverrides.Find(spawn->entry) ? noRegion : config.regionOverrides.FindIndex(spawn->mapId, spawn->x, spawn->y);
+            if (region != noRegion)
+                ++chunk.regionHits[region];
+
+            uint8 minLevel = ValidationLevel(config, spawn->expansion, spawn->minLevel);
+            uint8 maxLevel = ValidationLevel(config, spawn->expansion, spawn->maxLevel);
+            for (uint32 level = minLevel; level <= maxLevel; ++level)
+            {
+                query.level = uint8(level);
+
+                ScalingResult result;
+                result.expansion = spawn->expansion;
+                ResolveOverrides(config, query, spawn->mapId, spawn->rank, true, result);
+
+                if (spawn->health > 1 && float(spawn->health) * result.factors[SCALING_STAT_HEALTH] < 2.0f)
+                    chunk.floorHits.push_back({ result.source, SourceId(result.source, query, region, spawn->expansion), spawn->entry, spawn->health });
+            }
+        }
+    }
+
+    // Findings of one validation, logged once per override even where the
+    // snapshot's profiles repeat it, and capped per kind like rejected rows.
+    class OverrideFindings
+    {
+    public:
+        enum Kind : uint8
+        {
+            UnknownEntry,
+            UnspawnedEntry,
+            UnspawnedZone,
+            UnspawnedArea,
+            UnspawnedRegion,
+            HealthFloor,
+            MaxKinds
+        };
+
+        // True if the finding is new and within the log cap of its kind.
+        bool Add(Kind kind, uint32 id, uint8 detail = 0)
+        {
+            uint64 key = (uint64(kind) << 40) | (uint64(detail) << 32) | id;
+            if (!_seen.insert(key).second)
+                return false;
+
+            return ++_counts[kind] <= MAX_REPORTED_ROW_ERRORS;
+        }
+
+        std::size_t Count() const { return _seen.size(); }
+
+        void LogSuppressed() const
+        {
+            static constexpr char const* names[MaxKinds] =
+            {
+                "unknown creature entry",
+                "creature override without outdoor spawns",
+                "unused zone override",
+                "unused area override",
+                "unused region override",
+                "1 HP"
+            };
+
+            for (uint8 kind = 0; kind < MaxKinds; ++kind)
+                if (_counts[kind] > MAX_REPORTED_ROW_ERRORS)
+                    LOG_WARN("module", "OutdoorScaling: {} more {} warnings not shown.", _counts[kind] - MAX_REPORTED_ROW_ERRORS, names[kind]);
+        }
+
+    private:
+        // Override files can hold tens of thousands of rows, so lookups
+        // must not scan.
+        std::unordered_set<uint64> _seen;
+        std::array<uint32, MaxKinds> _counts{};
+    };
+
+    // Threads for a validation: the world thread keeps running meanwhile, so
+    // it gets a core to itself; small censuses are not split at all.
+    uint32 ValidationThreads(std::size_t spawns)
+    {
+        uint32 cores = std::thread::hardware_concurrency();
+        uint32 threads = cores > 1 ? cores - 1 : 1;
+        return uint32(std::clamp<std::size_t>(spawns / 4096, 1, threads));
+    }
+
+    // Resolves the census against one snapshot on worker threads and logs
+    // overrides that match no spawn or floor one's health.
+    void ValidateOverrides(OutdoorScalingConfig const& config, SpawnCensus const& census, OverrideFindings& findings)
+    {
+        std::vector<SpawnChunk> chunks(ValidationThreads(census.spawns.size()));
+        std::size_t const perChunk = (census.spawns.size() + chunks.size() - 1) / chunks.size();
+
+        std::vector<std::thread> workers;
+        for (std::size_t i = 1; i < chunks.size(); ++i)
+        {
+            std::size_t begin = std::min(i * perChunk, census.spawns.size());
+            std::size_t end = std::min(begin + perChunk, census.spawns.size());
+            workers.emplace_back(ResolveSpawnChunk, std::cref(config), census.spawns.data() + begin, census.spawns.data() + end, std::ref(chunks[i]));
+        }
+
+        ResolveSpawnChunk(config, census.spawns.data(), census.spawns.data() + std::min(perChunk, census.spawns.size()), chunks[0]);
+        for (std::thread& worker : workers)
+            worker.join();
+
+        std::vector<uint32> regionHits(config.regionOverrides.Size(), 0);
+        std::vector<HealthFloorHit> floorHits;
+        for (SpawnChunk& chunk : chunks)
+        {
+            floorHits.insert(floorHits.end(), chunk.floorHits.begin(), chunk.floorHits.end());
+            for (std::size_t region = 0; region < regionHits.size(); ++region)
+                regionHits[region] += chunk.regionHits[region];
+        }
+
+        std::string const& profile = config.profileName;
+
+        config.creatureOverrides.ForEach([&](uint32 entry, OverrideMults const& /*mults*/)
+        {
+            if (!Contains(census.entries, entry))
+            {
+                if (findings.Add(OverrideFindings::UnknownEntry, entry))
+                    LOG_WARN("module", "OutdoorScaling: profile '{}': creature override {} names no creature_template entry.", profile, entry);
+            }
+            else if (!Contains(census.spawnedEntries, entry) && findings.Add(OverrideFindings::UnspawnedEntry, entry))
+                LOG_WARN("module", "OutdoorScaling: profile '{}': creature override {} has no outdoor spawn and only applies to summoned creatures.", profile, entry);
+        });
+
+        // creature.zoneId and areaId are only filled in when the core is told
+        // to compute them; without them every zone would look unused.
+        if (!census.zones.empty() && census.zones.back())
+        {
+            for (uint32 zoneId = 1; zoneId < config.zoneOverrides.Bound(); ++zoneId)
+                if (config.zoneOverrides.Find(zoneId) && !Contains(census.zones, zoneId) && findings.Add(OverrideFindings::UnspawnedZone, zoneId))
+                    LOG_WARN("module", "OutdoorScaling: profile '{}': zone override {} matches no outdoor spawn{}.", profile, zoneId,
+                        Contains(census.otherZones, zoneId) ? " (the zone only has spawns in instances)" : "");
+
+            for (uint32 areaId = 1; areaId < config.areaOverrides.Bound(); ++areaId)
+                if (config.areaOverrides.Find(areaId) && !Contains(census.areas, areaId) && findings.Add(OverrideFindings::UnspawnedArea, areaId))
+                    LOG_WARN("module", "OutdoorScaling: profile '{}': area override {} matches no outdoor spawn{}.", profile, areaId,
+                        Contains(census.otherAreas, areaId) ? " (the area only has spawns in instances)" : "");
+        }
+
+        for (std::size_t region = 0; region < regionHits.size(); ++region)
+            if (!regionHits[region] && findings.Add(OverrideFindings::UnspawnedRegion, uint32(region)))
+                LOG_WARN("module", "OutdoorScaling: profile '{}': region override #{} (map {}) contains no outdoor spawn that it would scale.",
+                    profile, region + 1, config.mergedRegionRows[region].mapId);
+
+        // One line per override, with how many spawns it floors.
+        std::sort(floorHits.begin(), floorHits.end(), [](HealthFloorHit const& a, HealthFloorHit const& b)
+        {
+            return std::tie(a.source, a.id) < std::tie(b.source, b.id);
+        });
+
+        for (std::size_t i = 0, next = 0; i < floorHits.size(); i = next)
+        {
+            for (next = i + 1; next < floorHits.size() && floorHits[next].source == floorHits[i].source && floorHits[next].id == floorHits[i].id; ++next)
+                ;
+
+            HealthFloorHit const& hit = floorHits[i];
+            if (findings.Add(OverrideFindings::HealthFloor, hit.id, uint8(hit.source)))
+                LOG_WARN("module", "OutdoorScaling: profile '{}': {} {} scales {} spawns down to 1 HP, e.g. creature {} with {} HP.",
+                    profile, SourceToString(hit.source), hit.source == OutdoorScalingInfo::Source::RegionOverride ? hit.id + 1 : hit.id,
+                    next - i, hit.entry, hit.health);
+        }
+    }
+
+    // Checks the snapshot and its profiles against the census.
+    void ValidateSnapshot(OutdoorScalingConfig const& config, SpawnCensus const& census)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        OverrideFindings findings;
+        ValidateOverrides(config, census, findings);
+        for (auto const& profile : config.profiles)
+            ValidateOverrides(*profile, census, findings);
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        findings.LogSuppressed();
+
+        LOG_INFO("module", "OutdoorScaling: checked the overrides of {} profiles against {} templates and {} outdoor spawns in {} ms ({} threads), {} warnings.",
+            config.profiles.size() + 1, census.entries.size(), census.spawns.size(), elapsed.count(),
+            ValidationThreads(census.spawns.size()), findings.Count());
+    }
+
+    class OutdoorScaling_WorldScript : public WorldScript
+    {
+    public:
+        OutdoorScaling_WorldScript() : WorldScript("OutdoorScaling_WorldScript") { }
+
+        // Runs after the core config so the Rate.Creature.* values the factor
+        // tables normalize against are already loaded.
+        void OnAfterConfigLoad(bool reload) override
+        {
+            // Reloads are rare, so every one is timed.
+            PerfScope perf(PERF_HOOK_CONFIG_LOAD, true, 1);
+
+            // Build the whole snapshot before publishing it; readers keep using
+            // the previous one until the swap.
+            auto config = std::make_unique<OutdoorScalingConfig>();
+
+            config->enabled = sConfigMgr->GetOption<bool>("OutdoorScaling.Enable", true);
+
+            config->continentHealth[0] = sConfigMgr->GetOption<float>("OutdoorScaling.Continent.0.Health", 1.0f);
+            config->continentHealth[1] = sConfigMgr->GetOption<float>("OutdoorScaling.Continent.1.Health", 1.0f);
+            config->continentHealth[2] = sConfigMgr->GetOption<float>("OutdoorScaling.Continent.2.Health", 1.0f);
+
+            config->continentDamage[0] = sConfigMgr->GetOption<float>("OutdoorScaling.Continent.0.Damage", 1.0f);
+            config->continentDamage[1] = sConfigMgr->GetOption<float>("OutdoorScaling.Continent.1.Damage", 1.0f);
+            config->continentDamage[2] = sConfigMgr->GetOption<float>("OutdoorScaling.Continent.2.Damage", 1.0f);
+
+            config->rankHealth[CREATURE_ELITE_NORMAL]    = sConfigMgr->GetOption<float>("OutdoorScaling.Rank.Normal.Health", 1.0f);
+            config->rankHealth[CREATURE_ELITE_ELITE]     = sConfigMgr->GetOption<float>("OutdoorScaling.Rank.Elite.Health", 1.0f);
+            config->rankHealth[CREATURE_ELITE_RAREELITE] = sConfigMgr->GetOption<float>("OutdoorScaling.Rank.RareElite.Health", 1.0f);
+            config->rankHealth[CREATURE_ELITE_WORLDBOSS] = sConfigMgr->GetOption<float>("OutdoorScaling.Rank.WorldBoss.Health", 1.0f);
+            config->rankHealth[CREATURE_ELITE_RARE]      = sConfigMgr->GetOption<float>("OutdoorScaling.Rank.Rare.Health", 1.0f);
+
+            config->rankDamage[CREATURE_ELITE_NORMAL]    = sConfigMgr->GetOption<float>("OutdoorScaling.Rank.Normal.Damage", 1.0f);
+            config->rankDamage[CREATURE_ELITE_ELITE]     = sConfigMgr->GetOption<float>("OutdoorScaling.Rank.Elite.Damage", 1.0f);
+            config->rankDamage[CREATURE_ELITE_RAREELITE] = sConfigMgr->GetOption<float>("OutdoorScaling.Rank.RareElite.Damage", 1.0f);
+            config->rankDamage[CREATURE_ELITE_WORLDBOSS] = sConfigMgr->GetOption<float>("OutdoorScaling.Rank.WorldBoss.Damage", 1.0f);
+            config->rankDamage[CREATURE_ELITE_RARE]      = sConfigMgr->GetOption<float>("OutdoorScaling.Rank.Rare.Damage", 1.0f);
+
+            std::array<OverrideRows, MAX_OUTDOOR_EXPANSIONS> levelRows;
+            std::array<LevelDeltaRows, MAX_OUTDOOR_EXPANSIONS> deltaRows;
+            for (uint8 expansion = 0; expansion < MAX_OUTDOOR_EXPANSIONS; ++expansion)
+            {
+                std::string const index = std::to_string(expansion);
+                levelRows[expansion] = LoadConfigOverrides<OverrideRows>("OutdoorScaling.Level." + index + ".Curve");
+                deltaRows[expansion] = LoadConfigOverrides<LevelDeltaRows>("OutdoorScaling.LevelDelta." + index + ".Curve");
+            }
+
+            BuildLevelTables(*config, levelRows, deltaRows);
+
+            config->configRows[OVERRIDE_KIND_ZONE] = LoadConfigOverrides<OverrideRows>("OutdoorScaling.ZoneOverrides");
+            config->configRows[OVERRIDE_KIND_AREA] = LoadConfigOverrides<OverrideRows>("OutdoorScaling.AreaOverrides");
+            config->configRows[OVERRIDE_KIND_CREATURE] = LoadConfigOverrides<OverrideRows>("OutdoorScaling.CreatureOverrides");
+            config->regionRows = LoadConfigOverrides<RegionRows>("OutdoorScaling.RegionOverrides");
+
+            // Keep serving the last database rows (none before the first load
+            // completes) while a fresh query runs.
+            config->databaseEnabled = sConfigMgr->GetOption<bool>("OutdoorScaling.Database.Enable", false);
+            if (config->databaseEnabled)
+                config->database = gConfigStore.Get().database;
+
+            BuildOverrideTables(*config);
+
+            config->reapplyMaxPerTick = sConfigMgr->GetOption<uint32>("OutdoorScaling.Reapply.MaxPerTick", 200);
+            config->reapplyMaxMicroseconds = sConfigMgr->GetOption<uint32>("OutdoorScaling.Reapply.MaxMicrosecondsPerTick", 500);
+            if (!config->reapplyMaxPerTick)
+                config->reapplyMaxPerTick = 1;
+
+            config->populationEnabled = sConfigMgr->GetOption<bool>("OutdoorScaling.Population.Enable", false);
+            config->populationCurve.Build(LoadConfigOverrides<OverrideRows>("OutdoorScaling.Population.Curve"));
+            config->populationHysteresis = sConfigMgr->GetOption<uint32>("OutdoorScaling.Population.Hysteresis", 3);
+            config->populationMinChangeMs = sConfigMgr->GetOption<uint32>("OutdoorScaling.Population.MinChangeInterval", 120) * IN_MILLISECONDS;
+
+            config->validateEnabled = sConfigMgr->GetOption<bool>("OutdoorScaling.Validate.Enable", false);
+
+            config->perfEnabled = sConfigMgr->GetOption<bool>("OutdoorScaling.Perf.Enable", true);
+            config->perfSampleRate = sConfigMgr->GetOption<uint32>("OutdoorScaling.Perf.SampleRate", 64);
+            config->perfLogIntervalSeconds = sConfigMgr->GetOption<uint32>("OutdoorScaling.Perf.LogInterval", 0);
+
+            config->dumpDirectory = sConfigMgr->GetOption<std::string>("OutdoorScaling.Dump.Directory", "data");
+
+            BuildFactorTables(*config);
+
+            config->reapplyEnabled = sConfigMgr->GetOption<bool>("OutdoorScaling.Reapply.Enable", false);
+
+            BuildProfiles(*config);
+            uint32 activeProfile = SelectProfile(*config);
+
+            if (reload && config->reapplyEnabled)
+                StartReapply(gConfigStore.Get(), ProfileAt(*config, activeProfile));
+
+            gConfigStore.Publish(std::move(config), activeProfile);
+            gReapplyProgress.generation.store(gConfigStore.Get().generation, std::memory_order_relaxed);
+
+            StartBackgroundBuilds();
+        }
+
+        void OnUpdate(uint32 diff) override
+        {
+            gConfigStore.Reclaim();
+
+            gDump.Update(diff);
+
+            // Between world ticks, so no map update sees the switch halfway.
+            _profileTimer += diff;
+            if (_profileTimer >= ProfileCheckIntervalMs)
+            {
+                _profileTimer = 0;
+                UpdateProfile();
+            }
+
+            _queryProcessor.ProcessReadyCallbacks();
+            std::erase_if(_backgroundBuilds, [](std::future<void> const& build)
+            {
+                return build.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            });
+
+            if (_censusLoad.valid() && _censusLoad.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                _census = _censusLoad.get();
+                StartBackgroundBuilds();
+            }
+
+            OutdoorScalingConfig const& config = gConfigStore.Get();
+
+            _populationTimer += diff;
+            if (config.populationEnabled && _populationTimer >= PopulationUpdateIntervalMs)
+            {
+                _populationTimer = 0;
+                gPopulation.Update(uint64(std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count()),
+                    config.populationHysteresis, config.populationMinChangeMs);
+            }
+
+            if (!config.perfEnabled || !config.perfLogIntervalSeconds)
+                return;
+
+            _perfLogTimer += diff;
+            if (_perfLogTimer < config.perfLogIntervalSeconds * IN_MILLISECONDS)
+                return;
+
+            auto now = std::chrono::steady_clock::now();
+            PerfSnapshot current = gPerf.Aggregate();
+            PerfSnapshot delta = current - _lastPerfLog;
+            double seconds = std::chrono::duration<double>(now - _lastPerfLogTime).count();
+            _lastPerfLog = current;
+            _lastPerfLogTime = now;
+            _perfLogTimer = 0;
+
+            PerfSnapshot::Hook const& spawn = delta.hooks[PERF_HOOK_SELECT_LEVEL];
+            PerfSnapshot::Hook const& hit = delta.hooks[PERF_HOOK_SPELL_DAMAGE];
+            auto [spawnP99, spawnUnit] = FormatNs(PerfPercentileNs(spawn, 0.99));
+            auto [hitP99, hitUnit] = FormatNs(PerfPercentileNs(hit, 0.99));
+
+            LOG_INFO("module", "OutdoorScaling: last {:.0f}s: {} spawns ({:.1f}/s, p99 {:.1f} {}), {} spell hits ({:.1f}/s, p99 {:.1f} {}), resolves: {} continent, {} level, {} zone, {} area, {} region, {} creature.",
+                seconds,
+                spawn.calls, double(spawn.calls) / seconds, spawnP99, spawnUnit,
+                hit.calls, double(hit.calls) / seconds, hitP99, hitUnit,
+                delta.sources[uint8(OutdoorScalingInfo::Source::Continent)],
+                delta.sources[uint8(OutdoorScalingInfo::Source::LevelCurve)],
+                delta.sources[uint8(OutdoorScalingInfo::Source::ZoneOverride)],
+                delta.sources[uint8(OutdoorScalingInfo::Source::AreaOverride)],
+                delta.sources[uint8(OutdoorScalingInfo::Source::RegionOverride)],
+                delta.sources[uint8(OutdoorScalingInfo::Source::CreatureOverride)]);
+        }
+
+    private:
+        static void UpdateProfile()
+        {
+            OutdoorScalingConfig const& base = gConfigStore.GetBase();
+            uint32 profile = SelectProfile(base);
+            if (!gConfigStore.Activate(profile))
+                return;
+
+            LOG_INFO("module", "OutdoorScaling: scaling profile '{}' is now active.", ProfileAt(base, profile).profileName);
+        }
+
+        static void StartReapply(OutdoorScalingConfig const& previous, OutdoorScalingConfig& next)
+        {
+            BuildReapplyPlan(previous, next);
+            gReapplyProgress.passStart.store(gReapplyProgress.done.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        // Work that follows a published load: database rows first, whose build
+        // also validates, otherwise the validation alone. The census is read
+        // once, before either; reloads reuse it.
+        void StartBackgroundBuilds()
+        {
+            OutdoorScalingConfig const& base = gConfigStore.GetBase();
+            if (base.validateEnabled && !_census)
+            {
+                if (!_censusQueried)
+                    QuerySpawnCensus();
+                return;
+            }
+
+            if (base.databaseEnabled)
+                QueryDatabaseOverrides();
+            else if (base.validateEnabled)
+                StartValidation();
+        }
+
+        void QuerySpawnCensus()
+        {
+            _censusQueried = true;
+            _queryProcessor.AddCallback(WorldDatabase.AsyncQuery("SELECT t.`entry`, t.`rank`, t.`minlevel`, t.`maxlevel`, c.`map`, c.`zoneId`, c.`areaId`, c.`position_x`, c.`position_y`, c.`curhealth` "
+                "FROM `creature_template` t LEFT JOIN `creature` c ON c.`id1` = t.`entry`")
+                .WithCallback([this](QueryResult result)
+                {
+                    _censusLoad = std::async(std::launch::async, &ReadSpawnCensus, std::move(result));
+                }));
+        }
+
+        // Runs off the world thread on a copy of the loaded snapshot, which a
+        // background task must not hold on to past its grace period.
+        void StartValidation()
+        {
+            auto config = std::make_shared<OutdoorScalingConfig const>(gConfigStore.GetBase());
+            _backgroundBuilds.push_back(std::async(std::launch::async, [config, census = _census]()
+            {
+                ValidateSnapshot(*config, *census);
+            }));
+        }
+
+        // Startup is not blocked: until the query completes, the snapshot
+        // serves config overrides and continent defaults only.
+        void QueryDatabaseOverrides()
+        {
+            _queryProcessor.AddCallback(WorldDatabase.AsyncQuery("SELECT `Type`, `Id`, `HealthMult`, `DamageMult`, `MapId`, `X1`, `Y1`, `X2`, `Y2`, `Radius` "
+                "FROM `mod_outdoor_scaling_overrides` ORDER BY `Type`, `Id`")
+                .WithCallback([this](QueryResult result)
+                {
+                    // Copy the loaded snapshot now; a background task must not
+                    // hold on to it past its reclamation grace period.
+                    auto previous = std::make_shared<OutdoorScalingConfig const>(gConfigStore.GetBase());
+                    _backgroundBuilds.push_back(std::async(std::launch::async, &OutdoorScaling_WorldScript::BuildDatabaseSnapshot, std::move(result), std::move(previous), _census));
+                }));
+        }
+
+        // Runs off the world thread: reads the rows, rebuilds the lookup
+        // tables and swaps the new snapshot in.
+        static void BuildDatabaseSnapshot(QueryResult result, std::shared_ptr<OutdoorScalingConfig const> previous, std::shared_ptr<SpawnCensus const> census)
+        {
+            auto config = std::make_unique<OutdoorScalingConfig>(*previous);
+            config->database = ReadDatabaseOverrides(std::move(result));
+            config->reapply = ReapplyPlan();
+            BuildOverrideTables(*config);
+
+            // The copied profiles are still the live ones; rebuild fresh copies.
+            for (auto& profile : config->profiles)
+            {
+                auto rebuilt = std::make_shared<OutdoorScalingConfig>(*profile);
+                rebuilt->database = config->database;
+                rebuilt->reapply = ReapplyPlan();
+                BuildOverrideTables(*rebuilt);
+                profile = std::move(rebuilt);
+            }
+
+            if (config->validateEnabled && census)
+                ValidateSnapshot(*config, *census);
+
+            if (config->reapplyEnabled)
+            {
+                uint32 activeProfile = gConfigStore.ActiveProfile();
+                StartReapply(ProfileAt(*previous, activeProfile), ProfileAt(*config, activeProfile));
+            }
+
+            std::size_t zoneRows = config->database->rows[OVERRIDE_KIND_ZONE].size();
+            std::size_t areaRows = config->database->rows[OVERRIDE_KIND_AREA].size();
+            std::size_t creatureRows = config->database->rows[OVERRIDE_KIND_CREATURE].size();
+            std::size_t regionRows = config->database->regions.size();
+
+            // A config reload published meanwhile has queried again; its
+            // callback brings the rows in on top of the newer config.
+            if (!gConfigStore.PublishIfCurrent(std::move(config), previous->generation))
+                return;
+
+            gReapplyProgress.generation.store(gConfigStore.Get().generation, std::memory_order_relaxed);
+            LOG_INFO("module", "OutdoorScaling: loaded {} zone, {} area, {} creature and {} region overrides from the database.",
+                zoneRows, areaRows, creatureRows, regionRows);
+        }
+
+        static constexpr uint32 PopulationUpdateIntervalMs = 1 * IN_MILLISECONDS;
+        static constexpr uint32 ProfileCheckIntervalMs = 1 * IN_MILLISECONDS;
+
+        QueryCallbackProcessor _queryProcessor;
+        std::vector<std::future<void>> _backgroundBuilds;
+        // World database spawns for OutdoorScaling.Validate.Enable, read
+        // on first use.
+        std::shared_ptr<SpawnCensus const> _census;
+        std::future<std::shared_ptr<SpawnCensus const>> _censusLoad;
+        bool _censusQueried = false;
+        uint32 _populationTimer = 0;
+        uint32 _profileTimer = 0;
+        uint32 _perfLogTimer = 0;
+        PerfSnapshot _lastPerfLog;
+        std::chrono::steady_clock::time_point _lastPerfLogTime = gPerf.Started();
+    };
+
+    class OutdoorScaling_AllCreatureScript : public AllCreatureScript
     {
-        return expansion > 2 ? 2 : expansion;
-    }
+    public:
+        OutdoorScaling_AllCreatureScript() : AllCreatureScript("OutdoorScaling_AllCreatureScript") { }
 
-    std::unordered_map<uint32, std::pair<float, float>> ParseOverrideString(std::string const& input)
-    {
-        std::unordered_map<uint32, std::pair<float, float>> overrides;
+        void OnCreatureSelectLevel(const CreatureTemplate* /*cinfo*/, Creature* creature) override
+        {
+            if (!creature)
+                return;
 
-        std::string chunk;
-        std::stringstream ss(input);
+            OutdoorScalingConfig const& config = gConfigStore.Get();
+            PerfScope perf(PERF_HOOK_SELECT_LEVEL, config.perfEnabled, config.perfSampleRate);
 
-        while (std::getline(ss, chunk, ','))
-        {
-            std::stringstream line(chunk);
-            std::string idStr;
-            std::string hpStr;
-            std::string dmgStr;
+            // Anything without a record stays unscaled.
+            CreatureScalingTable* table = GetScalingTable(creature, config);
+            if (!table)
+                return;
 
-            line >> idStr >> hpStr >> dmgStr;
+            // Stats are rebuilt on every (re)spawn, so always resolve fresh here.
+            OutdoorScalingInfo* info = &table->Acquire(creature->GetGUID().GetCounter());
+            SetApplied(info, 1.0f, 1.0f, 0, table->Aggregates());
+            info->appliedGeneration = config.generation;
+            ScalingResult scaling = StoreScaling(creature, config, *table, info);
 
-            if (idStr.empty() || hpStr.empty())
-                continue;
+            if (!IsScaledSource(scaling.source))
+                return;
 
-            uint32 id = 0;
-            float hp = 0.0f;
-            float dmg = 0.0f;
+            float healthFactor = scaling.factors[SCALING_STAT_HEALTH];
+            int32 healthDelta = 0;
 
-            try
-            {
-                id = uint32(std::stoul(idStr));
-                hp = std::stof(hpStr);
-                dmg = dmgStr.empty() ? hp : std::stof(dmgStr);
-            }
-            catch (...)
+            if (healthFactor != 1.0f)
             {
-                continue;
-            }
+                uint32 oldMaxHealth = creature->GetMaxHealth();
+                uint32 newMaxHealth = uint32(float(oldMaxHealth) * healthFactor);
+                if (!newMaxHealth)
+                    newMaxHealth = 1;
 
-            if (hp <= 0.0f || dmg <= 0.0f)
-                continue;
+                creature->SetCreateHealth(newMaxHealth);
+                creature->SetMaxHealth(newMaxHealth);
+                creature->SetHealth(newMaxHealth);
+                creature->SetStatFlatModifier(UNIT_MOD_HEALTH, BASE_VALUE, float(newMaxHealth));
+                healthDelta = int32(newMaxHealth) - int32(oldMaxHealth);
+            }
 
-            overrides[id] = { hp, dmg };
+            ApplyDamageScale(creature, scaling.factors[SCALING_STAT_DAMAGE]);
+            SetApplied(info, healthFactor, scaling.factors[SCALING_STAT_DAMAGE], healthDelta, table->Aggregates());
         }
 
-        return overrides;
-    }
+        // After a profile switch, a creature's own update is the first safe
+        // point to re-scale its stats: no damage or heal calculation is in
+        // progress, and only creatures that are actually updated pay for it.
+        void OnAllCreatureUpdate(Creature* creature, uint32 /*diff*/) override
+        {
+            OutdoorScalingConfig const& config = gConfigStore.Get();
+            if (!config.reapplyEnabled || !IsOutdoorContinent(creature->GetMap()))
+                return;
 
-    struct ScalingResult
-    {
-        float healthMult = 1.0f;
-        float damageMult = 1.0f;
-        OutdoorScalingInfo::Source source = OutdoorScalingInfo::Source::None;
-        uint32 zoneId = 0;
-        uint8 expansion = 0;
-    };
+            if (GetContinentMapInfo(creature->GetMap(), config)->switchGeneration != config.generation)
+                return;
 
-    ScalingResult ComputeScaling(Map* map, uint32 zoneId, uint32 creatureEntry, bool isPetOrGuardian)
-    {
-        ScalingResult result;
-        result.zoneId = zoneId;
+            CreatureScalingTable* table = GetScalingTable(creature, config);
+            if (!table)
+                return;
 
-        if (!gConfig.enabled)
-        {
-            result.source = OutdoorScalingInfo::Source::Disabled;
-            return result;
+            OutdoorScalingInfo* info = table->Find(creature->GetGUID().GetCounter());
+            if (info && info->appliedGeneration != config.generation)
+                RescaleStats(creature, config, *table, info);
         }
 
-        if (!map || !IsOutdoorContinent(map))
+        void OnCreatureRemoveWorld(Creature* creature) override
         {
-            result.source = OutdoorScalingInfo::Source::NotOutdoor;
-            return result;
+            if (CreatureScalingTable* table = GetScalingTable(creature, gConfigStore.Get()))
+                table->Release(creature->GetGUID().GetCounter());
         }
+    };
+
+    class OutdoorScaling_AllMapScript : public AllMapScript
+    {
+    public:
+        OutdoorScaling_AllMapScript() : AllMapScript("OutdoorScaling_AllMapScript") { }
 
-        if (isPetOrGuardian)
+        void OnMapUpdate(Map* map, uint32 /*diff*/) override
         {
-            result.source = OutdoorScalingInfo::Source::PetOrGuardian;
-            return result;
-        }
+            // Every map takes part in a dump, instanced ones included.
+            if (uint32 dumpId = gDump.CollectingId())
+            {
+                OutdoorScalingMapInfo* mapInfo = GetMapInfo(map, gConfigStore.Get());
+                if (mapInfo->dumpId != dumpId)
+                    DumpMap(map, *mapInfo, dumpId);
+            }
 
-        MapEntry const* entry = map->GetEntry();
-        result.expansion = entry ? ClampExpansion(entry->Expansion()) : 0;
+            if (!IsOutdoorContinent(map))
+                return;
 
-        auto creatureIt = gConfig.creatureOverrides.find(creatureEntry);
-        if (creatureIt != gConfig.creatureOverrides.end())
-        {
-            result.healthMult = creatureIt->second.first;
-            result.damageMult = creatureIt->second.second;
-            result.source = OutdoorScalingInfo::Source::CreatureOverride;
-            return result;
-        }
+            OutdoorScalingConfig const& config = gConfigStore.Get();
+            OutdoorScalingMapInfo* mapInfo = GetMapInfo(map, config);
 
-        auto zoneIt = gConfig.zoneOverrides.find(zoneId);
-        if (zoneIt != gConfig.zoneOverrides.end())
-        {
-            result.healthMult = zoneIt->second.first;
-            result.damageMult = zoneIt->second.second;
-            result.source = OutdoorScalingInfo::Source::ZoneOverride;
-            return result;
-        }
+            // A reload queues the creatures its plan affects. A profile switch
+            // keeps the base generation and queues nothing: each creature
+            // re-scales at its own next update, see OnAllCreatureUpdate.
+            if (mapInfo->generation != config.generation)
+            {
+                bool reloaded = mapInfo->baseGeneration != config.baseGeneration;
+                mapInfo->generation = config.generation;
+                mapInfo->baseGeneration = config.baseGeneration;
+                if (!reloaded)
+                {
+                    if (config.reapplyEnabled)
+                        mapInfo->switchGeneration = config.generation;
+                }
+                else if (config.reapply.pending)
+                {
+                    QueueReapply(map, *mapInfo, [&config](Creature const* creature)
+                    {
+                        return config.reapply.Affects(creature->GetZoneId(), creature->GetAreaId(), creature->GetEntry());
+                    });
+                }
+            }
 
-        result.healthMult = gConfig.continentHealth[result.expansion];
-        result.damageMult = gConfig.continentDamage[result.expansion];
-        result.source = OutdoorScalingInfo::Source::Continent;
+            // Population changes re-scale live creatures of the affected
+            // zones with the same budget as a reload.
+            uint32 populationEpoch = gPopulation.Epoch();
+            if (mapInfo->populationEpoch != populationEpoch)
+            {
+                if (config.populationEnabled)
+                {
+                    std::vector<uint32> zones;
+                    gPopulation.CollectChangedZones(map->GetId(), mapInfo->populationEpoch, zones);
+                    if (!zones.empty())
+                    {
+                        QueueReapply(map, *mapInfo, [&zones](Creature const* creature)
+                        {
+                            return std::binary_search(zones.begin(), zones.end(), creature->GetZoneId());
+                        });
+                    }
+                }
 
-        return result;
-    }
+                mapInfo->populationEpoch = populationEpoch;
+            }
 
-    float GetWorldHealthRate(Creature const* creature)
-    {
-        if (!creature)
-            return 1.0f;
+            if (mapInfo->cursor < mapInfo->pending.size())
+                ProcessReapply(map, config, *mapInfo);
+        }
 
-        switch (creature->GetCreatureTemplate()->rank)
+    private:
+        template<class Filter>
+        static void QueueReapply(Map* map, OutdoorScalingMapInfo& mapInfo, Filter&& affects)
         {
-            case CREATURE_ELITE_NORMAL:      return sWorld->getRate(RATE_CREATURE_NORMAL_HP);
-            case CREATURE_ELITE_ELITE:       return sWorld->getRate(RATE_CREATURE_ELITE_ELITE_HP);
-            case CREATURE_ELITE_RAREELITE:   return sWorld->getRate(RATE_CREATURE_ELITE_RAREELITE_HP);
-            case CREATURE_ELITE_WORLDBOSS:   return sWorld->getRate(RATE_CREATURE_ELITE_WORLDBOSS_HP);
-            case CREATURE_ELITE_RARE:        return sWorld->getRate(RATE_CREATURE_ELITE_RARE_HP);
-            default:                         return sWorld->getRate(RATE_CREATURE_ELITE_ELITE_HP);
-        }
-    }
+            bool wasActive = mapInfo.cursor < mapInfo.pending.size();
 
-    float GetWorldDamageRate(Creature const* creature)
-    {
-        if (!creature)
-            return 1.0f;
+            // A pass still running from an earlier reload keeps its remaining
+            // creatures; revisiting one is harmless since re-application is
+            // relative to what the creature already has.
+            mapInfo.pending.erase(mapInfo.pending.begin(), mapInfo.pending.begin() + mapInfo.cursor);
+            mapInfo.cursor = 0;
 
-        switch (creature->GetCreatureTemplate()->rank)
-        {
-            case CREATURE_ELITE_NORMAL:      return sWorld->getRate(RATE_CREATURE_NORMAL_DAMAGE);
-            case CREATURE_ELITE_ELITE:       return sWorld->getRate(RATE_CREATURE_ELITE_ELITE_DAMAGE);
-            case CREATURE_ELITE_RAREELITE:   return sWorld->getRate(RATE_CREATURE_ELITE_RAREELITE_DAMAGE);
-            case CREATURE_ELITE_WORLDBOSS:   return sWorld->getRate(RATE_CREATURE_ELITE_WORLDBOSS_DAMAGE);
-            case CREATURE_ELITE_RARE:        return sWorld->getRate(RATE_CREATURE_ELITE_RARE_DAMAGE);
-            default:                         return sWorld->getRate(RATE_CREATURE_ELITE_ELITE_DAMAGE);
-        }
-    }
+            std::size_t before = mapInfo.pending.size();
+            ForEachCreature(map, [&mapInfo, &affects](Creature* creature)
+            {
+                if (affects(creature))
+                    mapInfo.pending.push_back(creature->GetGUID());
+            });
 
-    float GetWorldSpellDamageRate(Creature const* creature)
-    {
-        if (!creature)
-            return 1.0f;
+            gReapplyProgress.queued.fetch_add(uint32(mapInfo.pending.size() - before), std::memory_order_relaxed);
 
-        switch (creature->GetCreatureTemplate()->rank)
-        {
-            case CREATURE_ELITE_NORMAL:      return sWorld->getRate(RATE_CREATURE_NORMAL_SPELLDAMAGE);
-            case CREATURE_ELITE_ELITE:       return sWorld->getRate(RATE_CREATURE_ELITE_ELITE_SPELLDAMAGE);
-            case CREATURE_ELITE_RAREELITE:   return sWorld->getRate(RATE_CREATURE_ELITE_RAREELITE_SPELLDAMAGE);
-            case CREATURE_ELITE_WORLDBOSS:   return sWorld->getRate(RATE_CREATURE_ELITE_WORLDBOSS_SPELLDAMAGE);
-            case CREATURE_ELITE_RARE:        return sWorld->getRate(RATE_CREATURE_ELITE_RARE_SPELLDAMAGE);
-            default:                         return sWorld->getRate(RATE_CREATURE_ELITE_ELITE_SPELLDAMAGE);
+            if (!wasActive && !mapInfo.pending.empty())
+                gReapplyProgress.activeMaps.fetch_add(1, std::memory_order_relaxed);
         }
-    }
 
-    std::string SourceToString(OutdoorScalingInfo::Source source)
-    {
-        switch (source)
+        static void ProcessReapply(Map* map, OutdoorScalingConfig const& config, OutdoorScalingMapInfo& mapInfo)
         {
-            case OutdoorScalingInfo::Source::Continent:       return "Continent default";
-            case OutdoorScalingInfo::Source::ZoneOverride:    return "Zone override";
-            case OutdoorScalingInfo::Source::CreatureOverride:return "Creature override";
-            case OutdoorScalingInfo::Source::Disabled:        return "Module disabled";
-            case OutdoorScalingInfo::Source::NotOutdoor:      return "Not outdoor continent";
-            case OutdoorScalingInfo::Source::PetOrGuardian:   return "Pet/guardian excluded";
-            default:                                          return "Not scaled";
-        }
-    }
+            auto const start = std::chrono::steady_clock::now();
+            auto const budget = std::chrono::microseconds(config.reapplyMaxMicroseconds);
 
-    class OutdoorScaling_WorldScript : public WorldScript
-    {
-    public:
-        OutdoorScaling_WorldScript() : WorldScript("OutdoorScaling_WorldScript") { }
+            uint32 processed = 0;
+            while (mapInfo.cursor < mapInfo.pending.size() && processed < config.reapplyMaxPerTick)
+            {
+                if (Creature* creature = map->GetCreature(mapInfo.pending[mapInfo.cursor]))
+                    ReapplyScaling(creature, config);
 
-        void OnBeforeConfigLoad(bool /*reload*/) override
-        {
-            gConfig.enabled = sConfigMgr->GetOption<bool>("OutdoorScaling.Enable", true);
+                ++mapInfo.cursor;
+                ++processed;
 
-            gConfig.continentHealth[0] = sConfigMgr->GetOption<float>("OutdoorScaling.Continent.0.Health", 1.0f);
-            gConfig.continentHealth[1] = sConfigMgr->GetOption<float>("OutdoorScaling.Continent.1.Health", 1.0f);
-            gConfig.continentHealth[2] = sConfigMgr->GetOption<float>("OutdoorScaling.Continent.2.Health", 1.0f);
+                // Reading the clock is not free; only check every few creatures.
+                if (config.reapplyMaxMicroseconds && !(processed % 16) && std::chrono::steady_clock::now() - start >= budget)
+                    break;
+            }
 
-            gConfig.continentDamage[0] = sConfigMgr->GetOption<float>("OutdoorScaling.Continent.0.Damage", 1.0f);
-            gConfig.continentDamage[1] = sConfigMgr->GetOption<float>("OutdoorScaling.Continent.1.Damage", 1.0f);
-            gConfig.continentDamage[2] = sConfigMgr->GetOption<float>("OutdoorScaling.Continent.2.Damage", 1.0f);
+            gReapplyProgress.done.fetch_add(processed, std::memory_order_relaxed);
 
-            gConfig.zoneOverrides = ParseOverrideString(sConfigMgr->GetOption<std::string>("OutdoorScaling.ZoneOverrides", "", false));
-            gConfig.creatureOverrides = ParseOverrideString(sConfigMgr->GetOption<std::string>("OutdoorScaling.CreatureOverrides", "", false));
+            if (mapInfo.cursor >= mapInfo.pending.size())
+            {
+                mapInfo.pending.clear();
+                mapInfo.pending.shrink_to_fit();
+                mapInfo.cursor = 0;
+                gReapplyProgress.activeMaps.fetch_sub(1, std::memory_order_relaxed);
+            }
         }
     };
 
-    class OutdoorScaling_AllCreatureScript : public AllCreatureScript
+    class OutdoorScaling_PlayerScript : public PlayerScript
     {
     public:
-        OutdoorScaling_AllCreatureScript() : AllCreatureScript("OutdoorScaling_AllCreatureScript") { }
+        OutdoorScaling_PlayerScript() : PlayerScript("OutdoorScaling_PlayerScript") { }
 
-        void ApplyDamageScale(Creature* creature, float mult) const
+        void OnPlayerLogin(Player* player) override
         {
-            if (std::abs(mult - 1.0f) < std::numeric_limits<float>::epsilon())
-                return;
-
-            float worldDamageRate = GetWorldDamageRate(creature);
-            if (worldDamageRate <= 0.0f)
-                worldDamageRate = 1.0f;
-
-            float baseMin = creature->GetWeaponDamageRange(BASE_ATTACK, MINDAMAGE);
-            float baseMax = creature->GetWeaponDamageRange(BASE_ATTACK, MAXDAMAGE);
-            float offMin  = creature->GetWeaponDamageRange(OFF_ATTACK, MINDAMAGE);
-            float offMax  = creature->GetWeaponDamageRange(OFF_ATTACK, MAXDAMAGE);
-            float rngMin  = creature->GetWeaponDamageRange(RANGED_ATTACK, MINDAMAGE);
-            float rngMax  = creature->GetWeaponDamageRange(RANGED_ATTACK, MAXDAMAGE);
+            Track(player, player->GetZoneId());
+        }
 
-            float baseMinNorm = baseMin / worldDamageRate;
-            float baseMaxNorm = baseMax / worldDamageRate;
-            float offMinNorm  = offMin  / worldDamageRate;
-            float offMaxNorm  = offMax  / worldDamageRate;
-            float rngMinNorm  = rngMin  / worldDamageRate;
-            float rngMaxNorm  = rngMax  / worldDamageRate;
+        void OnPlayerLogout(Player* player) override
+        {
+            if (OutdoorScalingPlayerInfo* info = player->CustomData.Get<OutdoorScalingPlayerInfo>("OutdoorScalingPlayerInfo"))
+                Untrack(*info);
+        }
 
-            creature->SetBaseWeaponDamage(BASE_ATTACK, MINDAMAGE, baseMinNorm * mult);
-            creature->SetBaseWeaponDamage(BASE_ATTACK, MAXDAMAGE, baseMaxNorm * mult);
-            creature->SetBaseWeaponDamage(OFF_ATTACK, MINDAMAGE, offMinNorm * mult);
-            creature->SetBaseWeaponDamage(OFF_ATTACK, MAXDAMAGE, offMaxNorm * mult);
-            creature->SetBaseWeaponDamage(RANGED_ATTACK, MINDAMAGE, rngMinNorm * mult);
-            creature->SetBaseWeaponDamage(RANGED_ATTACK, MAXDAMAGE, rngMaxNorm * mult);
+        void OnPlayerUpdateZone(Player* player, uint32 newZone, uint32 /*newArea*/) override
+        {
+            Track(player, newZone);
         }
 
-        void OnCreatureSelectLevel(const CreatureTemplate* /*cinfo*/, Creature* creature) override
+    private:
+        // Counts are kept even while population scaling is disabled, so that
+        // enabling it on a reload starts from correct numbers.
+        static void Track(Player* player, uint32 zoneId)
         {
-            if (!creature)
-                return;
+            OutdoorScalingPlayerInfo* info = player->CustomData.GetDefault<OutdoorScalingPlayerInfo>("OutdoorScalingPlayerInfo");
+            Map* map = player->GetMap();
+            uint32 mapId = map ? map->GetId() : 0;
+            bool outdoor = IsOutdoorContinent(map);
 
-            OutdoorScalingInfo* info = creature->CustomData.GetDefault<OutdoorScalingInfo>("OutdoorScalingInfo");
-            ScalingResult scaling = ComputeScaling(creature->GetMap(), creature->GetZoneId(), creature->GetEntry(), creature->IsPet() || creature->IsGuardian());
+            if (info->counted && outdoor && info->mapId == mapId && info->zoneId == zoneId)
+                return;
 
-            info->healthMult = scaling.healthMult;
-            info->damageMult = scaling.damageMult;
-            info->zoneId = scaling.zoneId;
-            info->expansion = scaling.expansion;
-            info->source = scaling.source;
+            Untrack(*info);
 
-            if (scaling.source != OutdoorScalingInfo::Source::Continent &&
-                scaling.source != OutdoorScalingInfo::Source::ZoneOverride &&
-                scaling.source != OutdoorScalingInfo::Source::CreatureOverride)
-            {
+            if (!outdoor || !gPopulation.Add(mapId, zoneId, 1))
                 return;
-            }
 
-            float worldHealthRate = GetWorldHealthRate(creature);
-            if (worldHealthRate <= 0.0f)
-                worldHealthRate = 1.0f;
-
-            if (std::abs(scaling.healthMult - 1.0f) >= std::numeric_limits<float>::epsilon())
-            {
-                float baseHealth = float(creature->GetMaxHealth()) / worldHealthRate;
-                uint32 newMaxHealth = uint32(baseHealth * scaling.healthMult);
-                if (!newMaxHealth)
-                    newMaxHealth = 1;
+            info->mapId = mapId;
+            info->zoneId = zoneId;
+            info->counted = true;
+        }
 
-                creature->SetCreateHealth(newMaxHealth);
-                creature->SetMaxHealth(newMaxHealth);
-                creature->SetHealth(newMaxHealth);
-                creature->SetStatFlatModifier(UNIT_MOD_HEALTH, BASE_VALUE, float(newMaxHealth));
-            }
+        static void Untrack(OutdoorScalingPlayerInfo& info)
+        {
+            if (!info.counted)
+                return;
 
-            ApplyDamageScale(creature, scaling.damageMult);
+            gPopulation.Add(info.mapId, info.zoneId, -1);
+            info.counted = false;
         }
     };
 
@@ -346,33 +3730,80 @@ namespace
             if (!attacker || damage == 0 || !attacker->IsCreature())
                 return;
 
-            Creature* creature = attacker->ToCreature();
-            ScalingResult scaling = ComputeScaling(creature->GetMap(), creature->GetZoneId(), creature->GetEntry(), creature->IsPet() || creature->IsGuardian());
+            OutdoorScalingConfig const& config = gConfigStore.Get();
+            PerfScope perf(PERF_HOOK_SPELL_DAMAGE, config.perfEnabled, config.perfSampleRate);
 
-            OutdoorScalingInfo* info = creature->CustomData.GetDefault<OutdoorScalingInfo>("OutdoorScalingInfo");
-            info->healthMult = scaling.healthMult;
-            info->damageMult = scaling.damageMult;
-            info->zoneId = scaling.zoneId;
-            info->expansion = scaling.expansion;
-            info->source = scaling.source;
+            OutdoorScalingInfo const* info = GetScaling(attacker->ToCreature(), config);
+            float factor = info->spellDamageFactor * LevelDeltaDamage(config, info, attacker, target);
+            if (factor == 1.0f)
+                return;
 
-            if (scaling.source != OutdoorScalingInfo::Source::Continent &&
-                scaling.source != OutdoorScalingInfo::Source::ZoneOverride &&
-                scaling.source != OutdoorScalingInfo::Source::CreatureOverride)
-            {
+            damage = int32(float(damage) * factor);
+            if (damage == 0)
+                damage = (factor > 0.0f ? 1 : 0);
+        }
+
+        // Melee damage is already scaled through the creature's damage stats;
+        // only the level delta multiplier is applied per hit.
+        void ModifyMeleeDamage(Unit* target, Unit* attacker, uint32& damage) override
+        {
+            if (!attacker || !damage || !attacker->IsCreature() || !target || !target->IsPlayer())
                 return;
-            }
 
-            if (std::abs(scaling.damageMult - 1.0f) < std::numeric_limits<float>::epsilon())
+            OutdoorScalingConfig const& config = gConfigStore.Get();
+            if (!config.anyLevelDelta)
                 return;
 
-            float worldSpellRate = GetWorldSpellDamageRate(creature);
-            if (worldSpellRate <= 0.0f)
-                worldSpellRate = 1.0f;
+            PerfScope perf(PERF_HOOK_MELEE_DAMAGE, config.perfEnabled, config.perfSampleRate);
 
-            damage = int32((float(damage) / worldSpellRate) * scaling.damageMult);
-            if (damage == 0)
-                damage = (scaling.damageMult > 0.0f ? 1 : 0);
+            OutdoorScalingInfo const* info = GetScaling(attacker->ToCreature(), config);
+            float factor = LevelDeltaDamage(config, info, attacker, target);
+            if (factor != 1.0f)
+                damage = ScaleAmount(damage, factor);
+        }
+
+        // DoT ticks get the same world-rate normalized factor as direct spell
+        // damage; the core applies the spell damage rate to both.
+        void ModifyPeriodicDamageAurasTick(Unit* target, Unit* attacker, uint32& damage, SpellInfo const* /*spellInfo*/) override
+        {
+            if (!attacker || !damage || !attacker->IsCreature())
+                return;
+
+            OutdoorScalingConfig const& config = gConfigStore.Get();
+            PerfScope perf(PERF_HOOK_PERIODIC_DAMAGE, config.perfEnabled, config.perfSampleRate);
+
+            OutdoorScalingInfo const* info = GetScaling(attacker->ToCreature(), config);
+            float factor = info->spellDamageFactor * LevelDeltaDamage(config, info, attacker, target);
+            if (factor != 1.0f)
+                damage = ScaleAmount(damage, factor);
+        }
+
+        // Creature heals on creatures follow the healer's health multiplier, so
+        // a heal restores the same share of the scaled health pools it tops up.
+        // Heals on players are left alone. Heals are not subject to a world
+        // rate, so the module multiplier applies as is.
+        void ModifyHealReceived(Unit* target, Unit* healer, uint32& heal, SpellInfo const* /*spellInfo*/) override
+        {
+            if (!healer || !heal || !healer->IsCreature() || !target || target->IsPlayer())
+                return;
+
+            OutdoorScalingConfig const& config = gConfigStore.Get();
+            PerfScope perf(PERF_HOOK_HEAL, config.perfEnabled, config.perfSampleRate);
+
+            OutdoorScalingInfo const* info = GetScaling(healer->ToCreature(), config);
+            if (info->healthMult != 1.0f)
+                heal = ScaleAmount(heal, info->healthMult);
+        }
+
+    private:
+        // A positive amount never scales down to 0 while the factor is positive.
+        static uint32 ScaleAmount(uint32 amount, float factor)
+        {
+            double scaled = std::min(double(amount) * double(factor), double(std::numeric_limits<uint32>::max()));
+            if (scaled < 1.0)
+                return factor > 0.0f ? 1 : 0;
+
+            return uint32(scaled);
         }
     };
 
@@ -386,7 +3817,10 @@ namespace
             static ChatCommandTable osCommandTable =
             {
                 { "mapstat",      HandleOSMapStat,      SEC_PLAYER, Console::Yes },
-                { "creaturestat", HandleOSCreatureStat, SEC_PLAYER, Console::Yes }
+                { "creaturestat", HandleOSCreatureStat, SEC_PLAYER, Console::Yes },
+                { "reapply",      HandleOSReapply,      SEC_GAMEMASTER, Console::Yes },
+                { "perf",         HandleOSPerf,         SEC_GAMEMASTER, Console::Yes },
+                { "dump",         HandleOSDump,         SEC_ADMINISTRATOR, Console::Yes }
             };
 
             static ChatCommandTable rootTable =
@@ -398,15 +3832,33 @@ namespace
             return rootTable;
         }
 
-        static bool HandleOSMapStat(ChatHandler* handler, char const* /*args*/)
+        // .os mapstat [all]
+        static bool HandleOSMapStat(ChatHandler* handler, char const* args)
         {
+            // The console has no map of its own and gets the summary of all.
             Player* player = handler->GetPlayer();
+            if (!player || (args && std::string_view(args) == "all"))
+                return HandleOSMapStatAll(handler);
+
             Map* map = player->GetMap();
             uint32 zoneId = player->GetZoneId();
-            ScalingResult scaling = ComputeScaling(map, zoneId, 0, false);
+            uint32 areaId = player->GetAreaId();
+            OutdoorScalingConfig const& config = gConfigStore.Get();
+
+            // A normal creature of the player's level standing here.
+            ScalingQuery query;
+            query.map = map;
+            query.zoneId = zoneId;
+            query.areaId = areaId;
+            query.x = player->GetPositionX();
+            query.y = player->GetPositionY();
+            query.rank = CREATURE_ELITE_NORMAL;
+            query.level = player->GetLevel();
+            ScalingResult scaling = ComputeScaling(config, query);
 
             handler->PSendSysMessage("---");
-            handler->PSendSysMessage("{} (Map {}), Zone {}", map->GetMapName(), map->GetId(), zoneId);
+            handler->PSendSysMessage("{} (Map {}), Zone {}, Area {}", map->GetMapName(), map->GetId(), zoneId, areaId);
+            handler->PSendSysMessage("Scaling profile: {}", config.profileName);
 
             if (scaling.source == OutdoorScalingInfo::Source::Disabled)
             {
@@ -422,26 +3874,90 @@ namespace
 
             handler->PSendSysMessage("Continent base (exp {}): HP x{:.2f}, Damage x{:.2f}",
                 scaling.expansion,
-                gConfig.continentHealth[scaling.expansion],
-                gConfig.continentDamage[scaling.expansion]);
+                config.continentHealth[scaling.expansion],
+                config.continentDamage[scaling.expansion]);
 
-            auto zoneIt = gConfig.zoneOverrides.find(zoneId);
-            if (zoneIt != gConfig.zoneOverrides.end())
+            if (OverrideMults const* zoneOverride = config.zoneOverrides.Find(zoneId))
             {
                 handler->PSendSysMessage("Zone override: HP x{:.2f}, Damage x{:.2f}",
-                    zoneIt->second.first, zoneIt->second.second);
+                    zoneOverride->health, zoneOverride->damage);
             }
             else
             {
                 handler->PSendSysMessage("Zone override: none");
             }
 
+            SendLevelCurve(handler, config, scaling.expansion, player->GetLevel());
+            SendLocalOverrides(handler, config, map, areaId, player->GetPositionX(), player->GetPositionY());
+            SendPopulation(handler, config, map, zoneId);
+
             handler->PSendSysMessage("Active outdoor scaling: HP x{:.2f}, Damage x{:.2f} ({})",
                 scaling.healthMult, scaling.damageMult, SourceToString(scaling.source));
 
+            if (OutdoorScalingMapInfo const* mapInfo = map->CustomData.Get<OutdoorScalingMapInfo>("OutdoorScalingMapInfo"))
+                SendTotals(handler, "Creatures on this map", mapInfo->aggregates.Totals());
+
+            return true;
+        }
+
+        // One entry per loaded continent from the running per-map totals.
+        // Commands run on the world thread between map updates, so reading
+        // every map's totals here is safe.
+        static bool HandleOSMapStatAll(ChatHandler* handler)
+        {
+            handler->PSendSysMessage("---");
+
+            ScalingTotals all;
+            uint32 maps = 0;
+            sMapMgr->DoForAllMaps([&](Map* map)
+            {
+                OutdoorScalingMapInfo const* mapInfo = map->CustomData.Get<OutdoorScalingMapInfo>("OutdoorScalingMapInfo");
+                if (!mapInfo)
+                    return;
+
+                ScalingTotals totals = mapInfo->aggregates.Totals();
+                if (!totals.Count())
+                    return;
+
+                SendTotals(handler, std::string(map->GetMapName()) + " (Map " + std::to_string(map->GetId()) + ")", totals);
+                all += totals;
+                ++maps;
+            });
+
+            if (!maps)
+            {
+                handler->PSendSysMessage("No scaled creatures on any loaded map.");
+                return true;
+            }
+
+            SendTotals(handler, "All maps", all);
+            handler->PSendSysMessage("By expansion: {} Vanilla, {} BC, {} WotLK", all.expansions[0], all.expansions[1], all.expansions[2]);
             return true;
         }
 
+        static void SendTotals(ChatHandler* handler, std::string const& label, ScalingTotals const& totals)
+        {
+            auto count = [&totals](OutdoorScalingInfo::Source source) { return totals.sources[uint8(source)]; };
+
+            handler->PSendSysMessage("{}: {} of {} creatures scaled ({} continent, {} level, {} zone, {} area, {} region, {} creature)",
+                label, totals.scaled, totals.Count(),
+                count(OutdoorScalingInfo::Source::Continent),
+                count(OutdoorScalingInfo::Source::LevelCurve),
+                count(OutdoorScalingInfo::Source::ZoneOverride),
+                count(OutdoorScalingInfo::Source::AreaOverride),
+                count(OutdoorScalingInfo::Source::RegionOverride),
+                count(OutdoorScalingInfo::Source::CreatureOverride));
+
+            if (!totals.scaled)
+                return;
+
+            handler->PSendSysMessage("  Applied HP x{:.2f} mean, x{:.2f} max; Damage x{:.2f} mean, x{:.2f} max",
+                totals.HealthMean(), totals.healthMax, totals.DamageMean(), totals.damageMax);
+            handler->PSendSysMessage("  Max HP {} added, {} removed (net {})",
+                totals.healthAdded, totals.healthRemoved, int64(totals.healthAdded) - int64(totals.healthRemoved));
+        }
+
+        // .os creaturestat
         static bool HandleOSCreatureStat(ChatHandler* handler, char const* /*args*/)
         {
             Creature* creature = handler->getSelectedCreature();
@@ -460,40 +3976,36 @@ namespace
                 return false;
             }
 
-            OutdoorScalingInfo* info = creature->CustomData.GetDefault<OutdoorScalingInfo>("OutdoorScalingInfo");
-            ScalingResult scaling = ComputeScaling(map, creature->GetZoneId(), creature->GetEntry(), creature->IsPet() || creature->IsGuardian());
-
-            info->healthMult = scaling.healthMult;
-            info->damageMult = scaling.damageMult;
-            info->zoneId = scaling.zoneId;
-            info->expansion = scaling.expansion;
-            info->source = scaling.source;
+            OutdoorScalingConfig const& config = gConfigStore.Get();
+            OutdoorScalingInfo const* info = GetScaling(creature, config);
 
             handler->PSendSysMessage("---");
-            handler->PSendSysMessage("{} (Entry {}), Zone {}, Map {}",
-                creature->GetName(), creature->GetEntry(), creature->GetZoneId(), map->GetId());
+            handler->PSendSysMessage("{} (Entry {}, Level {}), Zone {}, Area {}, Map {}",
+                creature->GetName(), creature->GetEntry(), creature->GetLevel(), creature->GetZoneId(), creature->GetAreaId(), map->GetId());
 
             handler->PSendSysMessage("Continent base (exp {}): HP x{:.2f}, Damage x{:.2f}",
-                scaling.expansion,
-                gConfig.continentHealth[scaling.expansion],
-                gConfig.continentDamage[scaling.expansion]);
+                uint32(info->expansion),
+                config.continentHealth[info->expansion],
+                config.continentDamage[info->expansion]);
 
-            auto zoneIt = gConfig.zoneOverrides.find(creature->GetZoneId());
-            if (zoneIt != gConfig.zoneOverrides.end())
+            if (OverrideMults const* zoneOverride = config.zoneOverrides.Find(creature->GetZoneId()))
             {
                 handler->PSendSysMessage("Zone override: HP x{:.2f}, Damage x{:.2f}",
-                    zoneIt->second.first, zoneIt->second.second);
+                    zoneOverride->health, zoneOverride->damage);
             }
             else
             {
                 handler->PSendSysMessage("Zone override: none");
             }
 
-            auto creatureIt = gConfig.creatureOverrides.find(creature->GetEntry());
-            if (creatureIt != gConfig.creatureOverrides.end())
+            SendLevelCurve(handler, config, info->expansion, creature->GetLevel());
+            SendLocalOverrides(handler, config, map, creature->GetAreaId(), creature->GetPositionX(), creature->GetPositionY());
+            SendPopulation(handler, config, map, creature->GetZoneId());
+
+            if (OverrideMults const* creatureOverride = config.creatureOverrides.Find(creature->GetEntry()))
             {
                 handler->PSendSysMessage("Creature override: HP x{:.2f}, Damage x{:.2f}",
-                    creatureIt->second.first, creatureIt->second.second);
+                    creatureOverride->health, creatureOverride->damage);
             }
             else
             {
@@ -503,6 +4015,153 @@ namespace
             handler->PSendSysMessage("Active outdoor scaling: HP x{:.2f}, Damage x{:.2f} ({})",
                 info->healthMult, info->damageMult, SourceToString(info->source));
 
+            if (Player* player = handler->GetPlayer(); player && config.levelDeltaEnabled[info->expansion] && IsScaledSource(info->source))
+            {
+                handler->PSendSysMessage("Level delta vs you ({:+}): Damage x{:.2f}",
+                    int32(creature->GetLevel()) - int32(player->GetLevel()), LevelDeltaDamage(config, info, creature, player));
+            }
+
+            return true;
+        }
+
+        static void SendLevelCurve(ChatHandler* handler, OutdoorScalingConfig const& config, uint8 expansion, uint8 level)
+        {
+            if (!config.levelCurveEnabled[expansion])
+                return;
+
+            OverrideMults const& mults = config.levelCurve[expansion][std::min(level, MAX_SCALING_LEVEL)];
+            handler->PSendSysMessage("Level curve at level {}: HP x{:.2f}, Damage x{:.2f}", level, mults.health, mults.damage);
+        }
+
+        static void SendLocalOverrides(ChatHandler* handler, OutdoorScalingConfig const& config, Map* map, uint32 areaId, float x, float y)
+        {
+            if (OverrideMults const* areaOverride = config.areaOverrides.Find(areaId))
+                handler->PSendSysMessage("Area override: HP x{:.2f}, Damage x{:.2f}", areaOverride->health, areaOverride->damage);
+            else
+                handler->PSendSysMessage("Area override: none");
+
+            if (OverrideMults const* regionOverride = config.regionOverrides.Find(map->GetId(), x, y))
+                handler->PSendSysMessage("Region override at ({:.1f}, {:.1f}): HP x{:.2f}, Damage x{:.2f}", x, y, regionOverride->health, regionOverride->damage);
+            else
+                handler->PSendSysMessage("Region override at ({:.1f}, {:.1f}): none", x, y);
+        }
+
+        static void SendPopulation(ChatHandler* handler, OutdoorScalingConfig const& config, Map* map, uint32 zoneId)
+        {
+            if (!config.populationEnabled)
+                return;
+
+            uint32 effective = gPopulation.Effective(map->GetId(), zoneId);
+            OverrideMults population = config.populationCurve.Evaluate(effective);
+            handler->PSendSysMessage("Population: {} player(s) in zone, scaling for {}: HP x{:.2f}, Damage x{:.2f}",
+                gPopulation.Players(map->GetId(), zoneId), effective, population.health, population.damage);
+        }
+
+        // .os reapply
+        static bool HandleOSReapply(ChatHandler* handler, char const* /*args*/)
+        {
+            OutdoorScalingConfig const& config = gConfigStore.Get();
+            // Counters wrap; only the differences matter. A map thread may
+            // count a creature done before its queueing is visible here.
+            uint32 passStart = gReapplyProgress.passStart.load(std::memory_order_relaxed);
+            uint32 done = gReapplyProgress.done.load(std::memory_order_relaxed) - passStart;
+            uint32 queued = std::max(gReapplyProgress.queued.load(std::memory_order_relaxed) - passStart, done);
+            uint32 activeMaps = gReapplyProgress.activeMaps.load(std::memory_order_relaxed);
+
+            handler->PSendSysMessage("---");
+
+            if (!config.reapply.pending && !activeMaps)
+            {
+                handler->PSendSysMessage("No re-application queued for config generation {}.", config.generation);
+                return true;
+            }
+
+            handler->PSendSysMessage("Re-application for config generation {}: {}/{} creatures, {} map(s) in progress.",
+                gReapplyProgress.generation.load(std::memory_order_relaxed), done, queued, activeMaps);
+
+            handler->PSendSysMessage("Budget per map update: {} creatures, {} us.",
+                config.reapplyMaxPerTick, config.reapplyMaxMicroseconds);
+
+            return true;
+        }
+
+        // .os dump
+        static bool HandleOSDump(ChatHandler* handler, char const* /*args*/)
+        {
+            if (gDump.Running())
+            {
+                handler->PSendSysMessage("Outdoor scaling dump in progress ({}): {} creatures from {} maps written to '{}'.",
+                    gDump.Collecting() ? "collecting" : "writing", gDump.RowsWritten(), gDump.Maps(), gDump.Path());
+
+                if (gDump.Collecting())
+                {
+                    std::vector<ScalingDump::MapKey> waiting = gDump.Waiting();
+                    if (!waiting.empty())
+                        handler->PSendSysMessage("Waiting for {} maps: {}.", waiting.size(), ScalingDump::MapsToString(waiting));
+                }
+
+                return true;
+            }
+
+            std::tm now = Acore::Time::TimeBreakdown(GameTime::GetGameTime().count());
+            char name[64];
+            std::strftime(name, sizeof(name), "outdoor_scaling_dump_%Y%m%d_%H%M%S.csv", &now);
+
+            std::string path = (std::filesystem::path(gConfigStore.Get().dumpDirectory) / name).string();
+            gDump.Start(path);
+
+            handler->PSendSysMessage("Outdoor scaling dump started; every map adds its creatures on its next update, written to '{}'.", path);
+            return true;
+        }
+
+        // .os perf [reset]
+        static bool HandleOSPerf(ChatHandler* handler, char const* args)
+        {
+            static std::mutex baselineLock;
+            static PerfSnapshot baseline;
+            static auto baselineTime = gPerf.Started();
+
+            std::lock_guard<std::mutex> guard(baselineLock);
+
+            if (args && std::string_view(args) == "reset")
+            {
+                baseline = gPerf.Aggregate();
+                baselineTime = std::chrono::steady_clock::now();
+                handler->PSendSysMessage("Outdoor scaling perf counters reset.");
+                return true;
+            }
+
+            OutdoorScalingConfig const& config = gConfigStore.Get();
+            if (!config.perfEnabled)
+            {
+                handler->PSendSysMessage("Outdoor scaling perf counters are disabled (OutdoorScaling.Perf.Enable).");
+                return true;
+            }
+
+            PerfSnapshot delta = gPerf.Aggregate() - baseline;
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - baselineTime).count();
+            if (seconds <= 0.0)
+                seconds = 1.0;
+
+            handler->PSendSysMessage("---");
+            handler->PSendSysMessage("Outdoor scaling perf over the last {:.0f}s (timing 1 in {} calls per thread):", seconds, config.perfSampleRate);
+
+            static constexpr char const* hookNames[MAX_PERF_HOOKS] = { "Spawn (SelectLevel)", "Spell damage", "Melee damage", "Periodic damage", "Creature heal", "Config load" };
+            for (uint8 hook = 0; hook < MAX_PERF_HOOKS; ++hook)
+            {
+                PerfSnapshot::Hook const& stats = delta.hooks[hook];
+                auto [p50, p50Unit] = FormatNs(PerfPercentileNs(stats, 0.50));
+                auto [p99, p99Unit] = FormatNs(PerfPercentileNs(stats, 0.99));
+                auto [mean, meanUnit] = FormatNs(stats.sampled ? double(stats.sampledNs) / double(stats.sampled) : 0.0);
+
+                handler->PSendSysMessage("{}: {} calls ({:.1f}/s), p50 {:.1f} {}, p99 {:.1f} {}, mean {:.1f} {}",
+                    hookNames[hook], stats.calls, double(stats.calls) / seconds, p50, p50Unit, p99, p99Unit, mean, meanUnit);
+            }
+
+            handler->PSendSysMessage("Resolves by source:");
+            for (uint8 source = uint8(OutdoorScalingInfo::Source::Continent); source < MAX_SCALING_SOURCES; ++source)
+                handler->PSendSysMessage("  {}: {}", SourceToString(OutdoorScalingInfo::Source(source)), delta.sources[source]);
+
             return true;
         }
     };
@@ -512,6 +4171,8 @@ void AddOutdoorScalingScripts()
 {
     new OutdoorScaling_WorldScript();
     new OutdoorScaling_AllCreatureScript();
+    new OutdoorScaling_AllMapScript();
+    new OutdoorScaling_PlayerScript();
     new OutdoorScaling_UnitScript();
     new OutdoorScaling_CommandScript();
 }